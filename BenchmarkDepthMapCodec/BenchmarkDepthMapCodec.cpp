@@ -0,0 +1,188 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DepthMapCodec.h"
+
+// Synthetic distance map: a tilted floor, a sphere in front of it, sensor noise and invalid pixels
+// at the image border and behind the sphere
+static void generateMap(int width, int height, std::vector<uint16_t>& map)
+{
+  map.resize(static_cast<size_t>(width) * height);
+  uint32_t random = 12345u;
+  for (int row = 0; row < height; ++row)
+  {
+    for (int col = 0; col < width; ++col)
+    {
+      random = random * 1664525u + 1013904223u;
+      const int noise = static_cast<int>((random >> 24) % 7u) - 3;
+      const double dx = (col - width * 0.5) / width;
+      const double dy = (row - height * 0.5) / height;
+      double distance = 2000.0 + 1500.0 * dy + 300.0 * dx;
+      const double r2 = dx * dx + dy * dy;
+      if (r2 < 0.04)
+      {
+        distance = 1200.0 - 1000.0 * std::sqrt(0.04 - r2);
+      }
+      const bool invalid = (col < width / 20) || (r2 >= 0.04 && r2 < 0.045 && dx > 0.0);
+      map[static_cast<size_t>(row) * width + col] = invalid ? uint16_t(0) : static_cast<uint16_t>(distance + noise);
+    }
+  }
+}
+
+// Read a raw map of little endian 16 bit values as written by the raw recordings
+static bool readMap(const std::string& filename, int width, int height, std::vector<uint16_t>& map)
+{
+  std::ifstream file(filename.c_str(), std::ios::binary);
+  map.resize(static_cast<size_t>(width) * height);
+  file.read(reinterpret_cast<char*>(map.data()), map.size() * sizeof(uint16_t));
+  return file.good();
+}
+
+// Runs fn iterations times and returns the throughput in MB/s of raw map data
+template <typename Fn>
+static double measure(unsigned iterations, size_t rawBytes, Fn fn)
+{
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < iterations; ++i)
+  {
+    fn();
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return (static_cast<double>(rawBytes) * iterations) / (seconds * 1e6);
+}
+
+bool runBenchmark(int width, int height, unsigned iterations, const std::string& filename)
+{
+  using namespace visionary;
+
+  std::vector<uint16_t> map;
+  if (filename.empty())
+  {
+    generateMap(width, height, map);
+  }
+  else if (!readMap(filename, width, height, map))
+  {
+    std::printf("Failed to read %d x %d map from %s\n", width, height, filename.c_str());
+    return false;
+  }
+  const size_t rawBytes = map.size() * sizeof(uint16_t);
+
+  DepthMapCodec codec;
+  std::vector<uint8_t> encoded;
+  std::vector<uint16_t> decoded;
+  int decodedWidth = 0;
+  int decodedHeight = 0;
+  if (!codec.encode(map, width, height, encoded)
+    || !codec.decode(encoded, decoded, decodedWidth, decodedHeight)
+    || decoded != map)
+  {
+    std::printf("Round trip failed\n");
+    return false;
+  }
+
+  //-----------------------------------------------
+  // Raw copy as reference, then the codec single and multi threaded
+  std::vector<uint8_t> raw(rawBytes);
+  const double copyRate = measure(iterations, rawBytes, [&]()
+  {
+    std::memcpy(raw.data(), map.data(), rawBytes);
+  });
+  std::printf("Map %d x %d, raw %zu bytes, encoded %zu bytes, ratio %.2f\n", width, height, rawBytes, encoded.size(),
+              static_cast<double>(rawBytes) / encoded.size());
+  std::printf("raw copy:                    %8.0f MB/s\n", copyRate);
+
+  const unsigned threadCounts[] = { 1u, 0u };
+  for (size_t i = 0; i < sizeof(threadCounts) / sizeof(threadCounts[0]); ++i)
+  {
+    codec.setNumThreads(threadCounts[i]);
+    const double encodeRate = measure(iterations, rawBytes, [&]()
+    {
+      codec.encode(map, width, height, encoded);
+    });
+    const double decodeRate = measure(iterations, rawBytes, [&]()
+    {
+      codec.decode(encoded, decoded, decodedWidth, decodedHeight);
+    });
+    const char* threads = (threadCounts[i] == 1u) ? "1 thread" : "all threads";
+    std::printf("encode (%-11s):        %8.0f MB/s\n", threads, encodeRate);
+    std::printf("decode (%-11s):        %8.0f MB/s\n", threads, decodeRate);
+  }
+  return true;
+}
+
+int main(int argc, char* argv[])
+{
+  // Default is a synthetic map in the resolution of the Visionary-T VGA
+  int width = 640;
+  int height = 512;
+  unsigned iterations = 200u;
+  std::string filename;
+
+  bool showHelpAndExit = false;
+
+  int exitCode = 0;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::istringstream argstream(argv[i]);
+
+    if (argstream.get() != '-')
+    {
+      showHelpAndExit = true;
+      exitCode = 1;
+      break;
+    }
+    switch (argstream.get())
+    {
+    case 'h':
+      showHelpAndExit = true;
+      break;
+    case 'x':
+      argstream >> width;
+      break;
+    case 'y':
+      argstream >> height;
+      break;
+    case 'n':
+      argstream >> iterations;
+      break;
+    case 'f':
+      argstream >> filename;
+      break;
+    default:
+      showHelpAndExit = true;
+      exitCode = 1;
+      break;
+    }
+  }
+
+  if (showHelpAndExit || width <= 0 || height <= 0)
+  {
+    std::cout << argv[0] << " [option]*" << std::endl;
+    std::cout << "where option is one of" << std::endl;
+    std::cout << "-h          show this help and exit" << std::endl;
+    std::cout << "-x<width>   width of the map; default is 640" << std::endl;
+    std::cout << "-y<height>  height of the map; default is 512" << std::endl;
+    std::cout << "-n<cnt>     repeat each measurement <cnt> times; default is 200" << std::endl;
+    std::cout << "-f<file>    use the raw 16 bit little endian map in <file> instead of a synthetic map" << std::endl;
+
+    return exitCode;
+  }
+
+  return runBenchmark(width, height, iterations, filename) ? 0 : 1;
+}
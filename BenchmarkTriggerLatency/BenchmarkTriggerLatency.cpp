@@ -0,0 +1,240 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "LatencyStatistics.h"
+#include "VisionaryControl.h"
+#include "VisionaryDataStream.h"
+#include "VisionarySData.h"
+#include "VisionaryTData.h"
+#include "VisionaryTMiniData.h"
+
+// Frames received after a trigger which belong to an earlier trigger are skipped, up to this many
+static const int kMaxStaleFrames = 10;
+
+typedef std::chrono::steady_clock Clock;
+
+static double toMs(Clock::duration duration)
+{
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+static void printStatistics(const char* name, const visionary::LatencyStatistics& statistics)
+{
+  std::printf("%-18s %9.3f %9.3f %9.3f %9.3f\n", name, statistics.getPercentile(50.0), statistics.getPercentile(99.0),
+              statistics.getMax(), statistics.getMean());
+}
+
+bool runLatencyBenchmark(const std::string& device, const char ipAddress[], unsigned short dataPort, uint32_t numberOfTriggers, bool async)
+{
+  using namespace visionary;
+
+  std::shared_ptr<VisionaryData> pDataHandler;
+  VisionaryControl::ProtocolType protocol = VisionaryControl::ProtocolType::COLA_B;
+  if (device == "S")
+  {
+    pDataHandler = std::make_shared<VisionarySData>();
+  }
+  else if (device == "T")
+  {
+    pDataHandler = std::make_shared<VisionaryTData>();
+  }
+  else if (device == "TVGA")
+  {
+    pDataHandler = std::make_shared<VisionaryTData>();
+    protocol = VisionaryControl::ProtocolType::COLA_2;
+  }
+  else if (device == "TMini")
+  {
+    pDataHandler = std::make_shared<VisionaryTMiniData>();
+    protocol = VisionaryControl::ProtocolType::COLA_2;
+  }
+  else
+  {
+    std::printf("Unknown device type %s\n", device.c_str());
+    return false;
+  }
+
+  VisionaryDataStream dataStream(pDataHandler);
+  VisionaryControl visionaryControl;
+
+  //-----------------------------------------------
+  // Connect to devices data stream and control channel
+  if (!dataStream.open(ipAddress, htons(dataPort)))
+  {
+    std::printf("Failed to open data stream connection to device.\n");
+    return false;
+  }
+  if (!visionaryControl.open(protocol, ipAddress, 5000/*ms*/))
+  {
+    std::printf("Failed to open control connection to device.\n");
+    return false;
+  }
+
+  //-----------------------------------------------
+  // Triggers work only when the acquisition is stopped
+  visionaryControl.stopAcquisition();
+
+  LatencyStatistics controlRoundTrip;
+  LatencyStatistics sensorTime;
+  LatencyStatistics transferAndParse;
+  LatencyStatistics total;
+  uint32_t lostFrames = 0;
+  uint32_t staleFrames = 0;
+  uint32_t timestampErrors = 0;
+  bool hasLastFrame = false;
+  uint32_t lastFrameNum = 0;
+  uint64_t lastTimestampMS = 0;
+
+  for (uint32_t i = 0; i < numberOfTriggers; i++)
+  {
+    //-----------------------------------------------
+    // Trigger and wait for the acknowledgment, or only send the trigger
+    const Clock::time_point triggerStart = Clock::now();
+    const bool triggered = async ? visionaryControl.stepAcquisitionAsync() : visionaryControl.stepAcquisition();
+    const Clock::time_point triggerEnd = Clock::now();
+    if (!triggered)
+    {
+      std::printf("Trigger %u failed\n", i);
+      lostFrames++;
+      continue;
+    }
+
+    //-----------------------------------------------
+    // Receive the frame of this trigger. A frame belongs to an earlier trigger if it was already being read before
+    // the trigger, or if its frame number does not increase.
+    bool received = false;
+    for (int attempt = 0; attempt < kMaxStaleFrames && !received; attempt++)
+    {
+      if (!dataStream.getNextFrame())
+      {
+        break;
+      }
+      const FrameTiming& timing = dataStream.getLastFrameTiming();
+      const uint32_t frameNum = pDataHandler->getFrameNum();
+      if (timing.receiveStart < triggerStart || (hasLastFrame && frameNum <= lastFrameNum))
+      {
+        staleFrames++;
+        continue;
+      }
+      received = true;
+
+      if (hasLastFrame && pDataHandler->getTimestampMS() < lastTimestampMS)
+      {
+        timestampErrors++;
+      }
+      hasLastFrame = true;
+      lastFrameNum = frameNum;
+      lastTimestampMS = pDataHandler->getTimestampMS();
+
+      controlRoundTrip.add(toMs(triggerEnd - triggerStart));
+      // The frame may already be queued when the acknowledgment arrives
+      sensorTime.add(toMs(std::max(timing.receiveStart - triggerEnd, Clock::duration::zero())));
+      transferAndParse.add(toMs(timing.parseEnd - std::max(timing.receiveStart, triggerEnd)));
+      total.add(toMs(timing.parseEnd - triggerStart));
+    }
+    if (!received)
+    {
+      lostFrames++;
+    }
+
+    if (async && !visionaryControl.collectAcknowledgments())
+    {
+      std::printf("Trigger %u was not acknowledged\n", i);
+    }
+  }
+
+  visionaryControl.close();
+  dataStream.close();
+
+  //-----------------------------------------------
+  // Report the distributions
+  std::printf("%u triggers, %u frames, %u lost, %u stale frames skipped, %u timestamps going backwards\n",
+              numberOfTriggers, static_cast<uint32_t>(total.getCount()), lostFrames, staleFrames, timestampErrors);
+  std::printf("%-18s %9s %9s %9s %9s\n", "[ms]", "p50", "p99", "max", "mean");
+  printStatistics(async ? "trigger send" : "control round trip", controlRoundTrip);
+  printStatistics("sensor", sensorTime);
+  printStatistics("transfer + parse", transferAndParse);
+  printStatistics("total", total);
+  return total.getCount() > 0u;
+}
+
+int main(int argc, char* argv[])
+{
+  // Default values
+  std::string device = "T";
+  std::string deviceIpAddr = "192.168.1.10";
+  unsigned short deviceBlobCtrlPort = 2114u;
+  unsigned cnt = 200u;
+  bool async = false;
+
+  bool showHelpAndExit = false;
+
+  int exitCode = 0;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::istringstream argstream(argv[i]);
+
+    if (argstream.get() != '-')
+    {
+      showHelpAndExit = true;
+      exitCode = 1;
+      break;
+    }
+    switch (argstream.get())
+    {
+    case 'h':
+      showHelpAndExit = true;
+      break;
+    case 'd':
+      argstream >> device;
+      break;
+    case 'c':
+      argstream >> deviceBlobCtrlPort;
+      break;
+    case 'i':
+      argstream >> deviceIpAddr;
+      break;
+    case 'n':
+      argstream >> cnt;
+      break;
+    case 'a':
+      async = true;
+      break;
+    default:
+      showHelpAndExit = true;
+      exitCode = 1;
+      break;
+    }
+  }
+
+  if (showHelpAndExit)
+  {
+    std::cout << argv[0] << " [option]*" << std::endl;
+    std::cout << "Measures the time from a software trigger until the frame is received and parsed." << std::endl;
+    std::cout << "where option is one of" << std::endl;
+    std::cout << "-h          show this help and exit" << std::endl;
+    std::cout << "-d<device>  device type S, T, TVGA or TMini; default is T" << std::endl;
+    std::cout << "-i<IP>      connect to the device with IP address <IP>, e.g. 127.0.0.1 for an emulator; default is 192.168.1.10" << std::endl;
+    std::cout << "-c<port>    assume the BLOB control port of the device was configured to <port>; default is 2114" << std::endl;
+    std::cout << "-n<cnt>     fire <cnt> triggers; default is 200" << std::endl;
+    std::cout << "-a          send the triggers without waiting for the acknowledgment" << std::endl;
+
+    return exitCode;
+  }
+
+  return runLatencyBenchmark(device, deviceIpAddr.c_str(), deviceBlobCtrlPort, cnt, async) ? 0 : 1;
+}
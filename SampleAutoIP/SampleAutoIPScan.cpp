@@ -6,30 +6,37 @@
 // SICK AG, Waldkirch
 // email: TechSupport0905@sick.de
 
+#include <cstdio>
 #include <vector>
 
 #include "VisionaryAutoIPScan.h"
 
 int main()
 {
-  unsigned int timeout = 5000;  // The time how long to wait for a response from the devices. 
-  VisionaryAutoIPScan ipScan;
+  using namespace visionary;
 
-  std::vector<VisionaryAutoIPScan::DeviceInfo> deviceList = ipScan.doScan(timeout);  // scan for devices
-  printf("Number of found devices: %u \n", deviceList.size());
+  int timeout = 5000;  // The time how long to wait for a response from the devices. 
+  VisionaryAutoIPScan ipScan;
 
-  // print device info for every found device
-  for (auto it : deviceList)
+  // scan for devices on all network interfaces, print device info for every device as soon as it answers
+  std::vector<VisionaryAutoIPScan::DeviceInfo> deviceList;
+  const bool scanned = ipScan.scan(timeout, [&deviceList](const VisionaryAutoIPScan::DeviceInfo& deviceInfo)
+  {
+    printf("Device name: %s \n", deviceInfo.DeviceName.c_str());
+    printf("MAC Address: %s \n", deviceInfo.MacAddress.c_str());
+    printf("IP Address: %s \n", deviceInfo.IpAddress.c_str());
+    printf("Subnet: %s \n", deviceInfo.SubNet.c_str());
+    printf("Port %s \n", deviceInfo.Port.c_str());
+    deviceList.push_back(deviceInfo);
+  });
+  if (!scanned)
   {
-    printf("Device name: %s \n", it.DeviceName.c_str());
-    printf("MAC Address: %s \n", it.MacAddress.c_str());
-    printf("IP Address: %s \n", it.IpAddress.c_str());
-    printf("Subnet: %s \n", it.SubNet.c_str());
-    printf("Port %s \n", it.Port.c_str());
+    printf("Failed to open the scan socket \n");
   }
+  printf("Number of found devices: %u \n", static_cast<unsigned int>(deviceList.size()));
 
   // Wait for user before closing console
   printf("Press Enter to continue . . .");
   getchar();
   return 0;
-}
\ No newline at end of file
+}
@@ -14,13 +14,13 @@
 #include "VisionaryControl.h"
 #include "CoLaParameterReader.h"
 #include "CoLaParameterWriter.h"
+#include "InfoMessages.h"
 #include "VisionarySData.h"    // Header specific for the Stereo data
 #include "VisionaryDataStream.h"
 #include "PointXYZ.h"
-#include "PointCloudPlyWriter.h"
+#include "AsyncRecordingWriter.h"
 
 #include <chrono>
-#include <thread>
 
 bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t numberOfFrames)
 {
@@ -58,22 +58,24 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     //-----------------------------------------------
     // An example of reading an writing device parameters is shown here.
     // Use the "SOPAS Communication Interface Description" PDF to determine data types for other variables
+    // Variables with a single value are described once with their type and read or written through read() and write()
+    const CoLaVariable<uint32_t> framePeriodTimeVariable("framePeriodTime");
+    const CoLaVariable<uint32_t> integrationTimeUsVariable("integrationTimeUs");
+    const CoLaVariable<uint32_t> integrationTimeUsColorVariable("integrationTimeUsColor");
+    const CoLaVariable<bool> autoExposureParameterizedRunningVariable("autoExposureParameterizedRunning");
 
     //-----------------------------------------------
     // Set framePeriod parameter to 150000
     std::printf("Setting framePeriodTime to 150000\n");
-    CoLaCommand setFramePeriodCommand = CoLaParameterWriter(CoLaCommandType::WRITE_VARIABLE, "framePeriodTime").parameterUDInt(150000).build();
-    CoLaCommand setFramePeriodResponse = visionaryControl.sendCommand(setFramePeriodCommand);
-    if (setFramePeriodResponse.getError() == CoLaError::OK)
+    if (visionaryControl.write(framePeriodTimeVariable, 150000u))
     {
       std::printf("Successfully set framePeriodTime to 150000\n");
     }
 
     //-----------------------------------------------
     // Read framePeriod parameter
-    CoLaCommand getFramePeriodCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "framePeriodTime").build();
-    CoLaCommand framePeriodResponse = visionaryControl.sendCommand(getFramePeriodCommand);
-    uint32_t framePeriodTime = CoLaParameterReader(framePeriodResponse).readUDInt();
+    uint32_t framePeriodTime = 0;
+    visionaryControl.read(framePeriodTimeVariable, framePeriodTime);
     std::printf("Read framePeriodTime = %d\n", framePeriodTime);
 
     //-----------------------------------------------
@@ -107,14 +109,12 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
 
     // Read out actual integration time values (before auto exposure was triggered)
     // ATTENTION: This sample is based on the NORMAL acquisition mode; other modes may refer to other integration time variables
-    CoLaCommand getIntegrationTimeUsCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "integrationTimeUs").build();
-    CoLaCommand getIntegrationTimeUsResponse = visionaryControl.sendCommand(getIntegrationTimeUsCommand);
-    uint32_t integrationTimeUs = CoLaParameterReader(getIntegrationTimeUsResponse).readUDInt();
+    uint32_t integrationTimeUs = 0;
+    visionaryControl.read(integrationTimeUsVariable, integrationTimeUs);
     std::printf("Read integrationTimeUs = %d\n", integrationTimeUs);
 
-    CoLaCommand getIntegrationTimeUsColorCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "integrationTimeUsColor").build();
-    CoLaCommand getIntegrationTimeUsColorResponse = visionaryControl.sendCommand(getIntegrationTimeUsColorCommand);
-    uint32_t integrationTimeUsColor = CoLaParameterReader(getIntegrationTimeUsColorResponse).readUDInt();
+    uint32_t integrationTimeUsColor = 0;
+    visionaryControl.read(integrationTimeUsColorVariable, integrationTimeUsColor);
     std::printf("Read integrationTimeUsColor = %d\n", integrationTimeUsColor);
    
     /* Info: For White Balance exists no SOPAS variable; the changes are done internally in the device and applied to the image.
@@ -135,38 +135,20 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
           std::printf("ERROR: Invoking 'TriggerAutoExposureParameterized' fails! (autoExposureResponse: %d)\n", CoLaParameterReader(autoExposureResponse).readBool());
         }
 
-        // Wait until auto exposure method is finished 
-        bool autoExpParamRunning = true;
-        long long startTime = std::chrono::system_clock::now().time_since_epoch().count();
-        long long timeNow = startTime;
-        while (autoExpParamRunning)
+        // Wait until auto exposure method is finished, it should be done within 10 seconds
+        const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        if (!visionaryControl.waitForValue(autoExposureParameterizedRunningVariable, false, deadline))
         {
-          CoLaCommand getAutoExpParamRunningCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "autoExposureParameterizedRunning").build();
-          CoLaCommand autoExpParamRunningResponse = visionaryControl.sendCommand(getAutoExpParamRunningCommand);
-          autoExpParamRunning = CoLaParameterReader(autoExpParamRunningResponse).readBool();
-
-          timeNow = std::chrono::system_clock::now().time_since_epoch().count();
-          if ((timeNow - startTime) <= 10000000000) // 10 sec = 10 000 000 000 ns (time after auto exposure method should be finished)
-          {
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-          }
-          else 
-          {
-            std::printf("TIMEOUT: auto exposure function (Param: %d) needs longer than expected!\n", autoType);
-          }
+          std::printf("TIMEOUT: auto exposure function (Param: %d) needs longer than expected!\n", autoType);
         }
       }      
     }
 
     // Read out new integration time values (after auto exposure was triggered)
-    getIntegrationTimeUsCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "integrationTimeUs").build();
-    getIntegrationTimeUsResponse = visionaryControl.sendCommand(getIntegrationTimeUsCommand);
-    integrationTimeUs = CoLaParameterReader(getIntegrationTimeUsResponse).readUDInt();
+    visionaryControl.read(integrationTimeUsVariable, integrationTimeUs);
     std::printf("Read integrationTimeUs = %d\n", integrationTimeUs);
 
-    getIntegrationTimeUsColorCommand = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "integrationTimeUsColor").build();
-    getIntegrationTimeUsColorResponse = visionaryControl.sendCommand(getIntegrationTimeUsColorCommand);
-    integrationTimeUsColor = CoLaParameterReader(getIntegrationTimeUsColorResponse).readUDInt();
+    visionaryControl.read(integrationTimeUsColorVariable, integrationTimeUsColor);
     std::printf("Read integrationTimeUsColor = %d\n", integrationTimeUsColor);
 
     //-----------------------------------------------
@@ -176,31 +158,18 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     CoLaCommand messagesResponse = visionaryControl.sendCommand(getMessagesCommand);
 
     //-----------------------------------------------
-    // Read message array, length of array is always 25 items (see MSinfo in PDF).
-    CoLaParameterReader reader(messagesResponse);
-    for (int i = 0; i < 25; i++) // Read 25 items
+    // Decode the message array, length of array is always 25 items (see MSinfo in PDF).
+    std::vector<InfoMessage> messages;
+    if (!InfoMessageDecoder::decodeArray(messagesResponse, kInfoMessageCount, messages))
+    {
+      std::printf("Failed to read MSinfo\n");
+    }
+    for (size_t i = 0; i < messages.size(); i++)
     {
-      uint32_t errorId = reader.readUDInt();
-      uint32_t errorState = reader.readUDInt();
-
-      // Read ErrTimeType struct members for FirstTime
-      uint16_t firstTime_PwrOnCount = reader.readUInt();
-      uint32_t firstTime_OpSecs = reader.readUDInt();
-      uint32_t firstTime_TimeOccur = reader.readUDInt();
-
-      // Read ErrTimeType struct members for LastTime
-      uint16_t lastTime_PwrOnCount = reader.readUInt();
-      uint32_t lastTime_OpSecs = reader.readUDInt();
-      uint32_t lastTime_TimeOccur = reader.readUDInt();
-
-      uint16_t numberOccurance = reader.readUInt();
-      uint16_t errReserved = reader.readUInt();
-      std::string extInfo = reader.readFlexString();
-
       // Write all non-empty info messages to the console
-      if (errorId != 0)
+      if (messages[i].errorId != 0)
       {
-        std::printf("Info message [0x%032x], extInfo: %s, numberOccurance: %d\n", errorId, extInfo.c_str(), numberOccurance);
+        std::printf("Info message [0x%032x], extInfo: %s, numberOccurance: %d\n", messages[i].errorId, messages[i].extInfo.c_str(), messages[i].numberOccurance);
       }
     }
   }
@@ -216,6 +185,10 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
   // Stop image acquisition (works always, also when already stopped)
   visionaryControl.stopAcquisition();
 
+  //-----------------------------------------------
+  // Writes the recordings in the background, so the acquisition does not wait for the disk
+  AsyncRecordingWriter recorder;
+
   //-----------------------------------------------
   // Capture a single frame
   visionaryControl.stepAcquisition();
@@ -233,8 +206,8 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     // Write point cloud to PLY
     const char plyFilePath[] = "VisionaryS.ply";
     std::printf("Writing frame to %s\n", plyFilePath);
-    PointCloudPlyWriter::WriteFormatPLY(plyFilePath, pointCloud, pDataHandler->getRGBAMap(), true);
-    std::printf("Finished writing frame to %s\n", plyFilePath);
+    std::vector<uint32_t> rgbaMap = pDataHandler->getRGBAMap();
+    recorder.writePly(plyFilePath, std::move(pointCloud), std::move(rgbaMap), std::vector<uint16_t>(), true);
   }
 
   //-----------------------------------------------
@@ -253,6 +226,11 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
   // Stop acqusition
   visionaryControl.stopAcquisition();
 
+  //-----------------------------------------------
+  // Wait until the recordings are written
+  recorder.flush();
+  std::printf("Finished writing recordings\n");
+
   visionaryControl.close();
   dataStream.close();
   return true;
@@ -20,7 +20,7 @@
 #include "VisionaryTMiniData.h"    // Header specific for the Time of Flight data
 #include "VisionaryDataStream.h"
 #include "PointXYZ.h"
-#include "PointCloudPlyWriter.h"
+#include "AsyncRecordingWriter.h"
 
 bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t numberOfFrames)
 {
@@ -108,6 +108,10 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
 
 
 
+  //-----------------------------------------------
+  // Writes the recordings in the background, so the acquisition does not wait for the disk
+  AsyncRecordingWriter recorder;
+
   //-----------------------------------------------
   // Capture a single frame
   visionaryControl.stepAcquisition();
@@ -125,8 +129,8 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     // Write point cloud to PLY
     const char plyFilePath[] = "VisionaryT.ply";
     std::printf("Writing frame to %s\n", plyFilePath);
-    PointCloudPlyWriter::WriteFormatPLY(plyFilePath, pointCloud, pDataHandler->getIntensityMap(), true);
-    std::printf("Finished writing frame to %s\n", plyFilePath);
+    std::vector<uint16_t> intensityMap = pDataHandler->getIntensityMap();
+    recorder.writePly(plyFilePath, std::move(pointCloud), std::vector<uint32_t>(), std::move(intensityMap), true);
   }
 
   //-----------------------------------------------
@@ -142,6 +146,11 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     std::vector<uint16_t> intensityMap = pDataHandler->getIntensityMap();
   }
 
+  //-----------------------------------------------
+  // Wait until the recordings are written
+  recorder.flush();
+  std::printf("Finished writing recordings\n");
+
   visionaryControl.close();
   dataStream.close();
   return true;
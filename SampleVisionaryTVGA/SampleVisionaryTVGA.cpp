@@ -14,10 +14,11 @@
 #include "VisionaryControl.h"
 #include "CoLaParameterReader.h"
 #include "CoLaParameterWriter.h"
+#include "InfoMessages.h"
 #include "VisionaryTData.h"    // Header specific for the Time of Flight data
 #include "VisionaryDataStream.h"
 #include "PointXYZ.h"
-#include "PointCloudPlyWriter.h"
+#include "AsyncRecordingWriter.h"
 
 bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t numberOfFrames)
 {
@@ -79,31 +80,18 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     CoLaCommand messagesResponse = visionaryControl.sendCommand(getMessagesCommand);
 
     //-----------------------------------------------
-    // Read message array, length of array is always 25 items (see MSinfo in PDF).
-    CoLaParameterReader reader(messagesResponse);
-    for (int i = 0; i < 25; i++) // Read 25 items
+    // Decode the message array, length of array is always 25 items (see MSinfo in PDF).
+    std::vector<InfoMessage> messages;
+    if (!InfoMessageDecoder::decodeArray(messagesResponse, kInfoMessageCount, messages))
+    {
+      std::printf("Failed to read MSinfo\n");
+    }
+    for (size_t i = 0; i < messages.size(); i++)
     {
-      uint32_t errorId = reader.readUDInt();
-      uint32_t errorState = reader.readUDInt();
-
-      // Read ErrTimeType struct members for FirstTime
-      uint16_t firstTime_PwrOnCount = reader.readUInt();
-      uint32_t firstTime_OpSecs = reader.readUDInt();
-      uint32_t firstTime_TimeOccur = reader.readUDInt();
-
-      // Read ErrTimeType struct members for LastTime
-      uint16_t lastTime_PwrOnCount = reader.readUInt();
-      uint32_t lastTime_OpSecs = reader.readUDInt();
-      uint32_t lastTime_TimeOccur = reader.readUDInt();
-
-      uint16_t numberOccurance = reader.readUInt();
-      uint16_t errReserved = reader.readUInt();
-      std::string extInfo = reader.readFlexString();
-
       // Write all non-empty info messages to the console
-      if (errorId != 0)
+      if (messages[i].errorId != 0)
       {
-        std::printf("Info message [0x%032x], extInfo: %s, numberOccurance: %d\n", errorId, extInfo.c_str(), numberOccurance);
+        std::printf("Info message [0x%032x], extInfo: %s, numberOccurance: %d\n", messages[i].errorId, messages[i].extInfo.c_str(), messages[i].numberOccurance);
       }
     }
   }
@@ -119,6 +107,10 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
   // Stop image acquisition (works always, also when already stopped)
   visionaryControl.stopAcquisition();
 
+  //-----------------------------------------------
+  // Writes the recordings in the background, so the acquisition does not wait for the disk
+  AsyncRecordingWriter recorder;
+
   //-----------------------------------------------
   // Capture a single frame
   visionaryControl.stepAcquisition();
@@ -136,8 +128,8 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     // Write point cloud to PLY
     const char plyFilePath[] = "VisionaryT.ply";
     std::printf("Writing frame to %s\n", plyFilePath);
-    PointCloudPlyWriter::WriteFormatPLY(plyFilePath, pointCloud, pDataHandler->getIntensityMap(), true);
-    std::printf("Finished writing frame to %s\n", plyFilePath);
+    std::vector<uint16_t> intensityMap = pDataHandler->getIntensityMap();
+    recorder.writePly(plyFilePath, std::move(pointCloud), std::vector<uint32_t>(), std::move(intensityMap), true);
   }
 
   //-----------------------------------------------
@@ -170,6 +162,11 @@ bool runStreamingDemo(const char ipAddress[], unsigned short dataPort, uint32_t
     std::vector<uint16_t> intensityMap = pDataHandler->getIntensityMap();
   }
 
+  //-----------------------------------------------
+  // Wait until the recordings are written
+  recorder.flush();
+  std::printf("Finished writing recordings\n");
+
   visionaryControl.close();
   dataStream.close();
   return true;
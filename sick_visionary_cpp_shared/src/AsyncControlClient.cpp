@@ -0,0 +1,241 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "AsyncControlClient.h"
+
+namespace visionary
+{
+
+AsyncControlClient::AsyncControlClient()
+  : m_running(false)
+{
+}
+
+AsyncControlClient::~AsyncControlClient()
+{
+  close();
+}
+
+void AsyncControlClient::open(std::unique_ptr<TcpSocket> pTransport, std::unique_ptr<IProtocolHandler> pProtocolHandler)
+{
+  close();
+
+  m_pTransport = std::move(pTransport);
+  m_pProtocolHandler = std::move(pProtocolHandler);
+  m_running = true;
+  m_ioThread = std::thread(&AsyncControlClient::run, this);
+}
+
+void AsyncControlClient::close()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+  }
+  m_pendingCondition.notify_all();
+  if (m_ioThread.joinable())
+  {
+    m_ioThread.join();
+  }
+
+  // Nothing receives anymore, fail what is left
+  std::deque<PendingRequest> pending;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    pending.swap(m_pending);
+  }
+  for (size_t i = 0; i < pending.size(); i++)
+  {
+    complete(pending[i], false);
+  }
+
+  if (m_pProtocolHandler)
+  {
+    m_pProtocolHandler->closeSession();
+    m_pProtocolHandler = nullptr;
+  }
+  if (m_pTransport)
+  {
+    m_pTransport->shutdown();
+    m_pTransport = nullptr;
+  }
+}
+
+bool AsyncControlClient::isOpen() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_running;
+}
+
+std::future<CoLaCommand> AsyncControlClient::send(const CoLaCommand& cmd)
+{
+  std::shared_ptr<std::promise<CoLaCommand> > pPromise = std::make_shared<std::promise<CoLaCommand> >();
+  std::future<CoLaCommand> future = pPromise->get_future();
+  send(cmd, [pPromise](CoLaCommand response) { pPromise->set_value(std::move(response)); });
+  return future;
+}
+
+void AsyncControlClient::send(const CoLaCommand& cmd, Callback callback)
+{
+  PendingRequest pending;
+  pending.callback = callback;
+  pending.pWaiter = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (submit(&cmd.getBuffer(), m_frameBuffer, pending))
+    {
+      return;
+    }
+  }
+  callback(CoLaCommand::networkErrorCommand());
+}
+
+std::future<CoLaCommand> AsyncControlClient::sendFrame(std::vector<uint8_t>& frame)
+{
+  std::shared_ptr<std::promise<CoLaCommand> > pPromise = std::make_shared<std::promise<CoLaCommand> >();
+  std::future<CoLaCommand> future = pPromise->get_future();
+
+  PendingRequest pending;
+  pending.callback = [pPromise](CoLaCommand response) { pPromise->set_value(std::move(response)); };
+  pending.pWaiter = nullptr;
+  bool sent;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sent = submit(nullptr, frame, pending);
+  }
+  if (!sent)
+  {
+    pPromise->set_value(CoLaCommand::networkErrorCommand());
+  }
+  return future;
+}
+
+bool AsyncControlClient::execute(const std::vector<uint8_t>& request, std::vector<uint8_t>& response)
+{
+  Waiter waiter;
+  waiter.pResponse = &response;
+  waiter.done = false;
+  waiter.success = false;
+
+  PendingRequest pending;
+  pending.pWaiter = &waiter;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (!submit(&request, m_frameBuffer, pending))
+  {
+    return false;
+  }
+  while (!waiter.done)
+  {
+    m_waiterCondition.wait(lock);
+  }
+  return waiter.success;
+}
+
+bool AsyncControlClient::submit(const std::vector<uint8_t>* pRequest, std::vector<uint8_t>& frame, PendingRequest& pending)
+{
+  // m_mutex is held, so frames and request ids are not interleaved between threads
+  if (!m_running)
+  {
+    return false;
+  }
+  if (pRequest != nullptr)
+  {
+    m_pProtocolHandler->buildFrame(*pRequest, frame);
+  }
+  if (!m_pProtocolHandler->sendFrame(frame))
+  {
+    return false;
+  }
+  pending.reqId = m_pProtocolHandler->getRequestId(frame);
+  m_pending.push_back(std::move(pending));
+  m_pendingCondition.notify_one();
+  return true;
+}
+
+void AsyncControlClient::complete(PendingRequest& pending, bool success)
+{
+  if (pending.pWaiter != nullptr)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (success)
+      {
+        pending.pWaiter->pResponse->swap(m_receiveBuffer);
+      }
+      pending.pWaiter->success = success;
+      pending.pWaiter->done = true;
+    }
+    m_waiterCondition.notify_all();
+  }
+  else if (success)
+  {
+    pending.callback(CoLaCommand(std::move(m_receiveBuffer)));
+  }
+  else
+  {
+    pending.callback(CoLaCommand::networkErrorCommand());
+  }
+}
+
+void AsyncControlClient::run()
+{
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (m_running && m_pending.empty())
+      {
+        m_pendingCondition.wait(lock);
+      }
+      if (!m_running)
+      {
+        return;
+      }
+    }
+
+    // Only this thread receives, senders hold the mutex while they send
+    uint16_t reqId = 0;
+    const bool received = m_pProtocolHandler->receiveResponse(m_receiveBuffer, reqId);
+
+    std::deque<PendingRequest> completed;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!received)
+      {
+        // Timeout or lost connection. Responses arriving late would be matched to the wrong CoLa-B request,
+        // so nothing is received anymore and later commands fail until the connection is opened again.
+        m_running = false;
+        completed.swap(m_pending);
+      }
+      else
+      {
+        for (std::deque<PendingRequest>::iterator it = m_pending.begin(); it != m_pending.end(); ++it)
+        {
+          if (it->reqId == reqId)
+          {
+            completed.push_back(std::move(*it));
+            m_pending.erase(it);
+            break;
+          }
+        }
+      }
+    }
+    // A response nobody waits for is dropped
+    for (size_t i = 0; i < completed.size(); i++)
+    {
+      complete(completed[i], received);
+    }
+    if (!received)
+    {
+      return;
+    }
+  }
+}
+
+}
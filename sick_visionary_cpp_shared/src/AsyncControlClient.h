@@ -0,0 +1,120 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CoLaCommand.h"
+#include "IProtocolHandler.h"
+#include "TcpSocket.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Control connection which can be used from any number of threads. Commands are sent by the calling thread,
+/// an I/O thread receives the responses and hands them to the waiting caller. CoLa-2 responses are matched by
+/// their request id, CoLa-B responses by their order.
+///
+/// Callbacks run on the I/O thread. They may send further commands, but must not wait for a response.
+///
+/// When a response cannot be received, e.g. on a timeout, all pending commands fail and so do all later ones.
+/// A late response could not be told apart from the response to a later CoLa-B command. open and close must
+/// not be called while other threads use the client.
+/// </summary>
+class AsyncControlClient
+{
+public:
+  typedef std::function<void(CoLaCommand response)> Callback;
+
+  AsyncControlClient();
+
+  /// <summary>Closes the connection.</summary>
+  ~AsyncControlClient();
+
+  /// <summary>Take over a connected transport and the protocol handler with its session opened,
+  /// and start the I/O thread.</summary>
+  void open(std::unique_ptr<TcpSocket> pTransport, std::unique_ptr<IProtocolHandler> pProtocolHandler);
+
+  /// <summary>Close the connection. Pending commands complete with a network error command. If the device still
+  /// owes a response, this waits for the receive timeout of the transport.</summary>
+  void close();
+
+  /// <summary>False after close and after a response could not be received,
+  /// the connection has to be opened again then.</summary>
+  bool isOpen() const;
+
+  /// <summary>Send a command.</summary>
+  /// <returns>Future of the response, a network error command if the connection failed.</returns>
+  std::future<CoLaCommand> send(const CoLaCommand& cmd);
+
+  /// <summary>Send a command and call callback with the response on the I/O thread,
+  /// or on the calling thread if sending fails.</summary>
+  void send(const CoLaCommand& cmd, Callback callback);
+
+  /// <summary>Send a frame built by IProtocolHandler::buildFrame. The request id in the frame is updated.</summary>
+  /// <returns>Future of the response, a network error command if the connection failed.</returns>
+  std::future<CoLaCommand> sendFrame(std::vector<uint8_t>& frame);
+
+  /// <summary>Send a command buffer and wait for the response buffer. Buffers are exchanged with the I/O thread
+  /// instead of being allocated, so repeated calls do not allocate.</summary>
+  /// <returns>False on network errors.</returns>
+  bool execute(const std::vector<uint8_t>& request, std::vector<uint8_t>& response);
+
+private:
+  // No copies, the connection is owned
+  AsyncControlClient(const AsyncControlClient&);
+  const AsyncControlClient& operator=(const AsyncControlClient&);
+
+  // Caller of execute waiting for its response
+  struct Waiter
+  {
+    std::vector<uint8_t>* pResponse;
+    bool done;
+    bool success;
+  };
+
+  struct PendingRequest
+  {
+    uint16_t reqId;
+    Callback callback;
+    Waiter* pWaiter;
+  };
+
+  // build a frame from request, or send frame as it is if request is NULL, and register the pending request
+  bool submit(const std::vector<uint8_t>* pRequest, std::vector<uint8_t>& frame, PendingRequest& pending);
+  void complete(PendingRequest& pending, bool success);
+  void run();
+
+  std::unique_ptr<TcpSocket> m_pTransport;
+  std::unique_ptr<IProtocolHandler> m_pProtocolHandler;
+  std::thread m_ioThread;
+
+  // Guards everything below, and the protocol handler while sending
+  mutable std::mutex m_mutex;
+  std::condition_variable m_pendingCondition;
+  std::condition_variable m_waiterCondition;
+  bool m_running;
+  // Requests in the order they were sent
+  std::deque<PendingRequest> m_pending;
+  std::vector<uint8_t> m_frameBuffer;
+
+  // Used by the I/O thread only
+  std::vector<uint8_t> m_receiveBuffer;
+};
+
+}
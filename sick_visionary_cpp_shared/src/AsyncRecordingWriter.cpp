@@ -0,0 +1,275 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "AsyncRecordingWriter.h"
+
+#include "PointCloudPlyWriter.h"
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+// Buffer of the raw file, appended data is written to the file in blocks of this size
+static const size_t rawFileBufferSize = 4 * 1024 * 1024;
+
+AsyncRecordingWriter::AsyncRecordingWriter(size_t queueCapacity, OverflowPolicy policy)
+  : m_queueCapacity((queueCapacity < 1) ? 1 : queueCapacity)
+  , m_policy(policy)
+  , m_queuedJobs(0)
+  , m_stop(false)
+  , m_nextFlushId(0)
+  , m_lastFlushDone(0)
+  , m_writtenCount(0)
+  , m_droppedCount(0)
+  , m_failedCount(0)
+  , m_rawFileBuffer(rawFileBufferSize)
+{
+  // Started last, the thread uses all members above
+  m_thread = std::thread(&AsyncRecordingWriter::run, this);
+}
+
+AsyncRecordingWriter::~AsyncRecordingWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_jobQueued.notify_one();
+  m_thread.join();
+}
+
+bool AsyncRecordingWriter::writePly(const std::string& filename, std::vector<PointXYZ>&& points, bool useBinary)
+{
+  Job job;
+  job.type = Job::PLY;
+  job.filename = filename;
+  job.useBinary = useBinary;
+  job.points = std::move(points);
+  return enqueue(std::move(job));
+}
+
+bool AsyncRecordingWriter::writePly(const std::string& filename, std::vector<PointXYZ>&& points, std::vector<uint32_t>&& rgbaMap,
+                                    std::vector<uint16_t>&& intensityMap, bool useBinary)
+{
+  Job job;
+  job.type = Job::PLY;
+  job.filename = filename;
+  job.useBinary = useBinary;
+  job.points = std::move(points);
+  job.rgbaMap = std::move(rgbaMap);
+  job.intensityMap = std::move(intensityMap);
+  return enqueue(std::move(job));
+}
+
+bool AsyncRecordingWriter::writePly(const std::string& filename, std::vector<PointXYZRGB>&& points, bool useBinary)
+{
+  Job job;
+  job.type = Job::PLY_RGB;
+  job.filename = filename;
+  job.useBinary = useBinary;
+  job.rgbPoints = std::move(points);
+  return enqueue(std::move(job));
+}
+
+bool AsyncRecordingWriter::writePly(const std::string& filename, std::vector<PointXYZI>&& points, bool useBinary)
+{
+  Job job;
+  job.type = Job::PLY_INTENSITY;
+  job.filename = filename;
+  job.useBinary = useBinary;
+  job.intensityPoints = std::move(points);
+  return enqueue(std::move(job));
+}
+
+bool AsyncRecordingWriter::appendRaw(const std::string& filename, std::vector<uint8_t>&& data)
+{
+  Job job;
+  job.type = Job::RAW_BYTES;
+  job.filename = filename;
+  job.bytes = std::move(data);
+  return enqueue(std::move(job));
+}
+
+bool AsyncRecordingWriter::appendRaw(const std::string& filename, std::vector<uint16_t>&& map)
+{
+  Job job;
+  job.type = Job::RAW_MAP;
+  job.filename = filename;
+  job.map = std::move(map);
+  return enqueue(std::move(job));
+}
+
+void AsyncRecordingWriter::flush()
+{
+  // The flush job is queued regardless of the capacity and never dropped
+  std::unique_lock<std::mutex> lock(m_mutex);
+  Job job;
+  job.type = Job::FLUSH;
+  job.flushId = ++m_nextFlushId;
+  const uint64_t flushId = job.flushId;
+  m_queue.push_back(std::move(job));
+  m_jobQueued.notify_one();
+  m_flushDone.wait(lock, [&]() { return m_lastFlushDone >= flushId; });
+}
+
+uint64_t AsyncRecordingWriter::getWrittenCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_writtenCount;
+}
+
+uint64_t AsyncRecordingWriter::getDroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_droppedCount;
+}
+
+uint64_t AsyncRecordingWriter::getFailedCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_failedCount;
+}
+
+bool AsyncRecordingWriter::enqueue(Job&& job)
+{
+  // A dropped job is released after the lock, freeing large buffers takes a while
+  Job dropped;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_queuedJobs >= m_queueCapacity)
+    {
+      switch (m_policy)
+      {
+      case DROP_NEWEST:
+        ++m_droppedCount;
+        return false;
+      case DROP_OLDEST:
+        for (std::deque<Job>::iterator it = m_queue.begin(); it != m_queue.end(); ++it)
+        {
+          if (it->type != Job::FLUSH)
+          {
+            dropped = std::move(*it);
+            m_queue.erase(it);
+            --m_queuedJobs;
+            ++m_droppedCount;
+            break;
+          }
+        }
+        break;
+      case BLOCK:
+        m_jobTaken.wait(lock, [this]() { return m_queuedJobs < m_queueCapacity; });
+        break;
+      }
+    }
+    m_queue.push_back(std::move(job));
+    ++m_queuedJobs;
+  }
+  m_jobQueued.notify_one();
+  return true;
+}
+
+void AsyncRecordingWriter::run()
+{
+  for (;;)
+  {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_jobQueued.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+      if (m_queue.empty())
+      {
+        // Stopped and all jobs written
+        break;
+      }
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+      if (job.type != Job::FLUSH)
+      {
+        --m_queuedJobs;
+      }
+    }
+    m_jobTaken.notify_all();
+
+    const bool success = execute(job);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (job.type == Job::FLUSH)
+    {
+      m_lastFlushDone = job.flushId;
+      m_flushDone.notify_all();
+    }
+    else if (success)
+    {
+      ++m_writtenCount;
+    }
+    else
+    {
+      ++m_failedCount;
+    }
+  }
+
+  if (m_rawFile.is_open())
+  {
+    m_rawFile.close();
+  }
+}
+
+bool AsyncRecordingWriter::execute(Job& job)
+{
+  switch (job.type)
+  {
+  case Job::PLY:
+    return PointCloudPlyWriter::WriteFormatPLY(job.filename.c_str(), job.points, job.rgbaMap, job.intensityMap, job.useBinary);
+  case Job::PLY_RGB:
+    return PointCloudPlyWriter::WriteFormatPLY(job.filename.c_str(), job.rgbPoints, job.useBinary);
+  case Job::PLY_INTENSITY:
+    return PointCloudPlyWriter::WriteFormatPLY(job.filename.c_str(), job.intensityPoints, job.useBinary);
+  case Job::RAW_BYTES:
+    return appendToRawFile(job.filename, reinterpret_cast<const char*>(job.bytes.data()), job.bytes.size());
+  case Job::RAW_MAP:
+    swapLittleEndianArray(job.map.data(), job.map.size());
+    return appendToRawFile(job.filename, reinterpret_cast<const char*>(job.map.data()), job.map.size() * sizeof(uint16_t));
+  case Job::FLUSH:
+    if (m_rawFile.is_open())
+    {
+      m_rawFile.flush();
+    }
+    return true;
+  }
+  return false;
+}
+
+bool AsyncRecordingWriter::appendToRawFile(const std::string& filename, const char* pData, size_t size)
+{
+  if (!m_rawFile.is_open() || filename != m_rawFilename)
+  {
+    if (m_rawFile.is_open())
+    {
+      m_rawFile.close();
+    }
+    m_rawFile.clear();
+    // The buffer has to be set before the file is opened
+    m_rawFile.rdbuf()->pubsetbuf(m_rawFileBuffer.data(), static_cast<std::streamsize>(m_rawFileBuffer.size()));
+    m_rawFile.open(filename.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+    m_rawFilename = filename;
+    if (!m_rawFile.is_open())
+    {
+      return false;
+    }
+  }
+  m_rawFile.write(pData, static_cast<std::streamsize>(size));
+  if (!m_rawFile.good())
+  {
+    // Open the file again for the next job
+    m_rawFile.close();
+    return false;
+  }
+  return true;
+}
+
+}
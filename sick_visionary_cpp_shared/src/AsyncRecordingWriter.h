@@ -0,0 +1,153 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PointXYZ.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Writes point clouds and raw recordings on a background thread, so a slow disk does not hold up the acquisition.
+/// The data is handed over by moving it into a bounded queue, what happens when the queue is full is set by the
+/// overflow policy. Raw data appended to the same file in a row goes through one large file buffer.
+/// </summary>
+class AsyncRecordingWriter
+{
+public:
+  enum OverflowPolicy
+  {
+    /// Remove the oldest queued job to make room, the acquisition never waits
+    DROP_OLDEST,
+    /// Discard the new job, the acquisition never waits
+    DROP_NEWEST,
+    /// Wait until the writer thread has made room, nothing is lost
+    BLOCK
+  };
+
+  /// <summary>Start the writer thread.</summary>
+  /// <param name="queueCapacity">Number of jobs which can be queued, at least 1</param>
+  /// <param name="policy">What to do with a new job when the queue is full</param>
+  AsyncRecordingWriter(size_t queueCapacity = 8, OverflowPolicy policy = DROP_OLDEST);
+
+  /// <summary>Writes all queued jobs, then stops the writer thread.</summary>
+  ~AsyncRecordingWriter();
+
+  /// <summary>Queue a point cloud to be written with PointCloudPlyWriter::WriteFormatPLY.</summary>
+  /// <param name="filename">The file to save the point cloud to</param>
+  /// <param name="points">The points to save, moved into the queue</param>
+  /// <param name="useBinary">If the output file is binary or ascii</param>
+  /// <returns>Returns false if the job was dropped because the queue is full (DROP_NEWEST)</returns>
+  bool writePly(const std::string& filename, std::vector<PointXYZ>&& points, bool useBinary);
+
+  /// <summary>Same as above with colors and intensities, either map may be empty. The maps are moved into the queue.</summary>
+  bool writePly(const std::string& filename, std::vector<PointXYZ>&& points, std::vector<uint32_t>&& rgbaMap,
+                std::vector<uint16_t>&& intensityMap, bool useBinary);
+
+  /// <summary>Same as above for a point cloud with colors.</summary>
+  bool writePly(const std::string& filename, std::vector<PointXYZRGB>&& points, bool useBinary);
+
+  /// <summary>Same as above for a point cloud with intensities.</summary>
+  bool writePly(const std::string& filename, std::vector<PointXYZI>&& points, bool useBinary);
+
+  /// <summary>Queue raw data to be appended to a file, e.g. encoded maps (see DepthMapCodec) or received frames.</summary>
+  /// <param name="filename">The file to append the data to, created if it does not exist</param>
+  /// <param name="data">The data, moved into the queue</param>
+  /// <returns>Returns false if the job was dropped because the queue is full (DROP_NEWEST)</returns>
+  bool appendRaw(const std::string& filename, std::vector<uint8_t>&& data);
+
+  /// <summary>Same as above for a map, e.g. VisionaryTData::getDistanceMap(), which is written as 16 bit little endian values.</summary>
+  bool appendRaw(const std::string& filename, std::vector<uint16_t>&& map);
+
+  /// <summary>Wait until all jobs queued before the call are written and the raw file buffer is written to the file.</summary>
+  void flush();
+
+  /// <summary>Number of jobs written successfully.</summary>
+  uint64_t getWrittenCount() const;
+
+  /// <summary>Number of jobs dropped because the queue was full.</summary>
+  uint64_t getDroppedCount() const;
+
+  /// <summary>Number of jobs which could not be written, e.g. because the file could not be opened.</summary>
+  uint64_t getFailedCount() const;
+
+private:
+  struct Job
+  {
+    Job()
+      : type(FLUSH)
+      , useBinary(false)
+      , flushId(0)
+    {
+    }
+
+    enum Type
+    {
+      PLY,
+      PLY_RGB,
+      PLY_INTENSITY,
+      RAW_BYTES,
+      RAW_MAP,
+      FLUSH
+    };
+
+    Type type;
+    std::string filename;
+    bool useBinary;
+    std::vector<PointXYZ> points;
+    std::vector<PointXYZRGB> rgbPoints;
+    std::vector<PointXYZI> intensityPoints;
+    std::vector<uint32_t> rgbaMap;
+    std::vector<uint16_t> intensityMap;
+    std::vector<uint8_t> bytes;
+    std::vector<uint16_t> map;
+    uint64_t flushId;
+  };
+
+  // Queue the job according to the overflow policy, returns false if it was dropped
+  bool enqueue(Job&& job);
+  void run();
+  bool execute(Job& job);
+  bool appendToRawFile(const std::string& filename, const char* pData, size_t size);
+
+  const size_t m_queueCapacity;
+  const OverflowPolicy m_policy;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_jobQueued;
+  std::condition_variable m_jobTaken;
+  std::condition_variable m_flushDone;
+  std::deque<Job> m_queue;
+  // Number of queued jobs which are not flush jobs, compared against the capacity
+  size_t m_queuedJobs;
+  bool m_stop;
+  uint64_t m_nextFlushId;
+  uint64_t m_lastFlushDone;
+  uint64_t m_writtenCount;
+  uint64_t m_droppedCount;
+  uint64_t m_failedCount;
+
+  // Only used by the writer thread
+  std::ofstream m_rawFile;
+  std::string m_rawFilename;
+  std::vector<char> m_rawFileBuffer;
+
+  std::thread m_thread;
+};
+
+}
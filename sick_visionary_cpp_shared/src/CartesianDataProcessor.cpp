@@ -0,0 +1,110 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "CartesianDataProcessor.h"
+
+#include <limits>
+
+namespace visionary
+{
+
+static const size_t cartesianBlockSize = 64;
+
+CartesianDataProcessor::CartesianDataProcessor()
+  : m_minRange2(0.0f)
+  , m_maxRange2(std::numeric_limits<float>::infinity())
+  , m_minIntensity(-std::numeric_limits<float>::infinity())
+  , m_maxIntensity(std::numeric_limits<float>::infinity())
+{
+  clearTransform();
+}
+
+CartesianDataProcessor::~CartesianDataProcessor()
+{
+}
+
+void CartesianDataProcessor::setTransform(const double matrix[4 * 4])
+{
+  for (int i = 0; i < 3 * 4; ++i)
+  {
+    m_transform[i] = static_cast<float>(matrix[i]);
+  }
+}
+
+void CartesianDataProcessor::clearTransform()
+{
+  for (int i = 0; i < 3 * 4; ++i)
+  {
+    m_transform[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+  }
+}
+
+void CartesianDataProcessor::setRangeLimits(float minRange, float maxRange)
+{
+  // the squares of negative limits would be positive limits
+  m_minRange2 = (minRange > 0.0f) ? minRange * minRange : 0.0f;
+  m_maxRange2 = (maxRange >= 0.0f) ? maxRange * maxRange : -1.0f;
+}
+
+void CartesianDataProcessor::setIntensityLimits(float minIntensity, float maxIntensity)
+{
+  m_minIntensity = minIntensity;
+  m_maxIntensity = maxIntensity;
+}
+
+size_t CartesianDataProcessor::process(const PointXYZC* input, size_t count, PointXYZC* output) const
+{
+  const float m0 = m_transform[0], m1 = m_transform[1], m2 = m_transform[2], m3 = m_transform[3];
+  const float m4 = m_transform[4], m5 = m_transform[5], m6 = m_transform[6], m7 = m_transform[7];
+  const float m8 = m_transform[8], m9 = m_transform[9], m10 = m_transform[10], m11 = m_transform[11];
+  const float minRange2 = m_minRange2;
+  const float maxRange2 = m_maxRange2;
+  const float minIntensity = m_minIntensity;
+  const float maxIntensity = m_maxIntensity;
+
+  // The points are transformed and checked in blocks into local buffers, which the compiler vectorizes.
+  // The buffers also make processing in place safe, the whole block is read before it is written.
+  size_t numPoints = 0;
+  for (size_t blockBegin = 0; blockBegin < count; blockBegin += cartesianBlockSize)
+  {
+    const size_t blockSize = (count - blockBegin < cartesianBlockSize) ? count - blockBegin : cartesianBlockSize;
+    const PointXYZC* pBlock = input + blockBegin;
+    PointXYZC transformed[cartesianBlockSize];
+    uint8_t valid[cartesianBlockSize];
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+      const float x = pBlock[i].x;
+      const float y = pBlock[i].y;
+      const float z = pBlock[i].z;
+      const float c = pBlock[i].c;
+      const float range2 = x * x + y * y + z * z;
+      valid[i] = ((range2 >= minRange2) & (range2 <= maxRange2) & (c >= minIntensity) & (c <= maxIntensity)) ? 1u : 0u;
+      transformed[i].x = m0 * x + m1 * y + m2 * z + m3;
+      transformed[i].y = m4 * x + m5 * y + m6 * z + m7;
+      transformed[i].z = m8 * x + m9 * y + m10 * z + m11;
+      transformed[i].c = c;
+    }
+
+    // Compaction without branches, see VisionaryData::generatePointCloud
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+      output[numPoints] = transformed[i];
+      numPoints += valid[i];
+    }
+  }
+  return numPoints;
+}
+
+void CartesianDataProcessor::process(const std::vector<PointXYZC>& input, std::vector<PointXYZC>& output) const
+{
+  // Resizing does not move the data if input and output are the same vector
+  output.resize(input.size());
+  output.resize(process(input.data(), input.size(), output.data()));
+}
+
+}
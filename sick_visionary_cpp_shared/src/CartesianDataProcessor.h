@@ -0,0 +1,63 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "VisionaryData.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Transforms and filters the cartesian data set of the Visionary-T (VisionaryTData::getCartesianData()) in one pass.
+/// Points outside of the range or intensity (C) limits are removed, the remaining points are transformed and
+/// written to the output without gaps. Invalid (NaN) points are always removed.
+/// </summary>
+class CartesianDataProcessor
+{
+public:
+  CartesianDataProcessor();
+  ~CartesianDataProcessor();
+
+  /// <summary>Transform the points, e.g. by CameraParameters::cam2worldMatrix.</summary>
+  /// <param name="matrix">Row major 4x4 matrix. The translation has to be in the unit of the points.</param>
+  void setTransform(const double matrix[4 * 4]);
+
+  /// <summary>Remove the transform set by setTransform.</summary>
+  void clearTransform();
+
+  /// <summary>Keep only points whose distance to the origin (before the transform) is within the limits (inclusive).
+  /// A negative minRange is the same as 0, a negative maxRange keeps no points.</summary>
+  void setRangeLimits(float minRange, float maxRange);
+
+  /// <summary>Keep only points whose C value is within the limits (inclusive).</summary>
+  void setIntensityLimits(float minIntensity, float maxIntensity);
+
+  /// <summary>Process an array of points.</summary>
+  /// <param name="input">Points to process</param>
+  /// <param name="count">Number of points</param>
+  /// <param name="output">Room for count points, may be the same as input to process the points in place</param>
+  /// <returns>Returns the number of points written to output</returns>
+  size_t process(const PointXYZC* input, size_t count, PointXYZC* output) const;
+
+  /// <summary>Process the points of input into output. The output is resized to the number of points kept.
+  /// If output is reused between frames, it is only allocated when the number of input points grows.</summary>
+  void process(const std::vector<PointXYZC>& input, std::vector<PointXYZC>& output) const;
+
+private:
+  // Row major 3x4 part of the transform, identity if no transform is set
+  float m_transform[3 * 4];
+  // Squared range limits
+  float m_minRange2, m_maxRange2;
+  float m_minIntensity, m_maxIntensity;
+};
+
+}
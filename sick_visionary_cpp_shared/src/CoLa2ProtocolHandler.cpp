@@ -7,6 +7,8 @@
 // email: TechSupport0905@sick.de
 
 #include "CoLa2ProtocolHandler.h"
+
+#include <algorithm>
 #include "VisionaryEndian.h"
 
 namespace visionary 
@@ -26,7 +28,8 @@ CoLa2ProtocolHandler::~CoLa2ProtocolHandler()
 bool CoLa2ProtocolHandler::openSession(uint8_t sessionTimeout /*secs*/)
 {
   // TODO: request session id and open session
-  std::vector<std::uint8_t> buffer = createCoLa2Header();
+  std::vector<std::uint8_t> buffer;
+  appendCoLa2Header(buffer);
   buffer.push_back('O'); // Open Session
   buffer.push_back('x');
   buffer.push_back(sessionTimeout);  // sessionTimeout secs timeout
@@ -77,88 +80,108 @@ uint16_t CoLa2ProtocolHandler::getReqId()
   return ++m_ReqID;
 }
 
-std::vector<std::uint8_t> CoLa2ProtocolHandler::createCoLa2Header()
+uint16_t CoLa2ProtocolHandler::appendCoLa2Header(std::vector<std::uint8_t>& buffer)
 {
-  std::vector<std::uint8_t> header;
+  const size_t headerStart = buffer.size();
 
   // insert magic bytes
   const uint8_t MAGIC_BYTE = 0x02;
   // inserts 8 bytes at front (Magic Bytes and length)
-  for (uint8_t i = 0; i < 8; i++)
-  {
-    header.push_back(MAGIC_BYTE);
-  }
+  buffer.insert(buffer.end(), 8, MAGIC_BYTE);
+
   // add HubCntr
-  header.push_back(0); // TBD
+  buffer.push_back(0); // TBD
 
   // add NoC
-  header.push_back(0); // TBD
+  buffer.push_back(0); // TBD
 
   // add SockIdx0
-  //header.insert(header.end(), { 0, 0, 0, 1 }); // TBD
+  //buffer.insert(buffer.end(), { 0, 0, 0, 1 }); // TBD
 
   // add SessionID
-  header.insert(header.end(), { 0, 0, 0, 0 });
-  *reinterpret_cast<uint32_t*>(&header[10]) = nativeToBigEndian(static_cast<uint32_t>(m_sessionID));
+  buffer.insert(buffer.end(), 4, 0);
+  writeUnalignBigEndian<uint32_t>(&buffer[headerStart + 10], m_sessionID);
   // add ReqID
-  header.insert(header.end(), { 0, 0 });
-  *reinterpret_cast<uint16_t*>(&header[14]) = nativeToBigEndian(static_cast<uint16_t>(getReqId()));
+  const uint16_t reqId = getReqId();
+  buffer.insert(buffer.end(), 2, 0);
+  writeUnalignBigEndian<uint16_t>(&buffer[headerStart + 14], reqId);
 
-  return header;
+  return reqId;
 }
 
-CoLaCommand CoLa2ProtocolHandler::send(CoLaCommand cmd)
+uint16_t CoLa2ProtocolHandler::appendFrame(const std::vector<std::uint8_t>& cmdBuffer, std::vector<std::uint8_t>& buffer)
 {
   //
-  // convert cola cmd to vector buffer and add/fill header
+  // add/fill header around the cola cmd buffer
   //
 
-  std::vector<std::uint8_t> buffer;
-  buffer = cmd.getBuffer();
-
-  std::vector<std::uint8_t> header = createCoLa2Header();
+  const size_t frameStart = buffer.size();
 
-  buffer.erase(buffer.begin()); // remove 's' from CoLaCommand buffer, not used in CoLa2
-  buffer.insert(buffer.begin(), header.begin(), header.end());
-  header.clear();
+  const uint16_t reqId = appendCoLa2Header(buffer);
+  if (!cmdBuffer.empty())
+  {
+    // remove 's' from CoLaCommand buffer, not used in CoLa2
+    buffer.insert(buffer.end(), cmdBuffer.begin() + 1, cmdBuffer.end());
+  }
 
   // Overwrite length
-  *reinterpret_cast<uint32_t*>(&buffer[4]) = nativeToBigEndian(static_cast<uint32_t>(buffer.size()) - 8);
+  writeUnalignBigEndian<uint32_t>(&buffer[frameStart + 4], static_cast<uint32_t>(buffer.size() - frameStart) - 8);
 
-  // Add checksum to end
-  //buffer.insert(buffer.end(), calculateChecksum(buffer));
-
-  //
-  // send to socket
-  //
-  
-  m_rTransport.send(buffer);
-  buffer.clear();
+  return reqId;
+}
 
-  //
-  // get response
-  //
-  
-  m_rTransport.read(buffer, sizeof(uint32_t));
+bool CoLa2ProtocolHandler::receiveFrame(uint16_t& reqId, std::vector<std::uint8_t>& buffer)
+{
+  if (m_rTransport.read(buffer, sizeof(uint32_t)) <= 0)
+  {
+    return false;
+  }
   // check for magic bytes
   const std::vector<uint8_t> MagicBytes = { 0x02, 0x02, 0x02, 0x02 };
-  bool result = std::equal(MagicBytes.begin(), MagicBytes.end(), buffer.begin());
-  if (result)
+  if (!std::equal(MagicBytes.begin(), MagicBytes.end(), buffer.begin()))
   {
-    // get length
-    m_rTransport.read(buffer, sizeof(uint32_t));
-    const uint32_t length = readUnalignBigEndian<uint32_t>(buffer.data());
-    m_rTransport.read(buffer, length);
+    return false;
   }
-  else
+  // get length
+  if (m_rTransport.read(buffer, sizeof(uint32_t)) <= 0)
   {
-    // drop invalid data
-    buffer.clear();
+    return false;
   }
-  buffer.erase(buffer.begin(), buffer.begin() + 8); // drop header
-  buffer.insert(buffer.begin(), 's'); // insert 's'
-  CoLaCommand response(buffer);
-  return response;
+  const uint32_t length = readUnalignBigEndian<uint32_t>(buffer.data());
+  // HubCntr, NoC, SessionID and ReqID precede the command
+  if (length < 8 || m_rTransport.read(buffer, length) <= 0)
+  {
+    return false;
+  }
+  reqId = readUnalignBigEndian<uint16_t>(&buffer[6]);
+
+  buffer[7] = 's'; // replace header by 's'
+  buffer.erase(buffer.begin(), buffer.begin() + 7);
+  return true;
+}
+
+void CoLa2ProtocolHandler::buildFrame(const std::vector<uint8_t>& request, std::vector<uint8_t>& frame)
+{
+  frame.clear();
+  appendFrame(request, frame);
+}
+
+bool CoLa2ProtocolHandler::sendFrame(std::vector<uint8_t>& frame)
+{
+  // only session and request id change between sends of the same frame
+  writeUnalignBigEndian<uint32_t>(&frame[10], m_sessionID);
+  writeUnalignBigEndian<uint16_t>(&frame[14], getReqId());
+  return m_rTransport.send(frame) >= 0;
+}
+
+uint16_t CoLa2ProtocolHandler::getRequestId(const std::vector<uint8_t>& frame) const
+{
+  return readUnalignBigEndian<uint16_t>(&frame[14]);
+}
+
+bool CoLa2ProtocolHandler::receiveResponse(std::vector<uint8_t>& response, uint16_t& reqId)
+{
+  return receiveFrame(reqId, response);
 }
 
 uint8_t CoLa2ProtocolHandler::calculateChecksum(const std::vector<uint8_t>& buffer)
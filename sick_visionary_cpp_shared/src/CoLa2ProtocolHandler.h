@@ -24,8 +24,10 @@ public:
   bool openSession(uint8_t sessionTimeout/*secs*/);
   void closeSession();
 
-  // send cola cmd and receive cola response
-  CoLaCommand send(CoLaCommand cmd);
+  void buildFrame(const std::vector<uint8_t>& request, std::vector<uint8_t>& frame);
+  bool sendFrame(std::vector<uint8_t>& frame);
+  uint16_t getRequestId(const std::vector<uint8_t>& frame) const;
+  bool receiveResponse(std::vector<uint8_t>& response, uint16_t& reqId);
 
 private:
   ITransport& m_rTransport;
@@ -33,7 +35,12 @@ private:
   uint32_t m_sessionID;
   uint8_t calculateChecksum(const std::vector<uint8_t>& buffer);
   uint16_t getReqId();
-  std::vector<std::uint8_t> createCoLa2Header();
+  // append a header with a new request id to buffer, returns the request id
+  uint16_t appendCoLa2Header(std::vector<std::uint8_t>& buffer);
+  // append the frame of a cola cmd to buffer, returns the request id of the frame
+  uint16_t appendFrame(const std::vector<std::uint8_t>& cmdBuffer, std::vector<std::uint8_t>& buffer);
+  // receive one response frame, returns false on network errors
+  bool receiveFrame(uint16_t& reqId, std::vector<std::uint8_t>& buffer);
 
 };
 
@@ -7,13 +7,17 @@
 // email: TechSupport0905@sick.de
 
 #include "CoLaBProtocolHandler.h"
+
 #include "VisionaryEndian.h"
 
 namespace visionary 
 {
 
+const size_t CoLaBProtocolHandler::kReceiveChunkSize;
+
 CoLaBProtocolHandler::CoLaBProtocolHandler(ITransport& rTransport)
 : m_rTransport(rTransport)
+, m_receivePos(0)
 {
 }
 
@@ -32,70 +36,116 @@ void CoLaBProtocolHandler::closeSession()
   // we don't have a session id byte in CoLaB protocol. Nothing to do here.
 }
 
-CoLaCommand CoLaBProtocolHandler::send(CoLaCommand cmd)
+void CoLaBProtocolHandler::buildFrame(const std::vector<uint8_t>& request, std::vector<uint8_t>& frame)
 {
   //
-  // convert cola cmd to vector buffer and add/fill header
+  // add/fill header around the cola cmd buffer
   //
 
-  std::vector<std::uint8_t> buffer;
-  buffer = cmd.getBuffer();
-
-  // insert magic bytes
+  // 8 bytes in front (Magic Bytes and length), the command and the checksum
   const uint8_t MAGIC_BYTE = 0x02;
-  // inserts 8 bytes at front (Magic Bytes and length)
-  auto it = buffer.begin();
-  for (uint8_t i = 0; i < 8; i++)
-  {
-    it = buffer.insert(it, MAGIC_BYTE);
-  }
+  frame.clear();
+  frame.reserve(8 + request.size() + 1);
+  frame.insert(frame.end(), 8, MAGIC_BYTE);
+  frame.insert(frame.end(), request.begin(), request.end());
   // Overwrite length
-  *reinterpret_cast<uint32_t*>(&buffer[4]) = nativeToBigEndian(static_cast<uint32_t>(buffer.size()) - 8);
+  writeUnalignBigEndian<uint32_t>(&frame[4], static_cast<uint32_t>(request.size()));
   
   // Add checksum to end
-  buffer.insert(buffer.end(), calculateChecksum(buffer));
+  frame.push_back(calculateChecksum(frame));
+}
 
-  //
-  // send to socket
-  //
-  
-  m_rTransport.send(buffer);
-  buffer.clear();
+bool CoLaBProtocolHandler::sendFrame(std::vector<uint8_t>& frame)
+{
+  // CoLaB frames have no request id, the frame is sent as it was built
+  return m_rTransport.send(frame) >= 0;
+}
 
-  //
-  // get response
-  //
+uint16_t CoLaBProtocolHandler::getRequestId(const std::vector<uint8_t>& /*frame*/) const
+{
+  return 0;
+}
 
-  size_t stxRecv = 0;
+bool CoLaBProtocolHandler::receiveResponse(std::vector<uint8_t>& response, uint16_t& reqId)
+{
+  reqId = 0;
+  return receiveFrame(response);
+}
 
-  while (stxRecv < 4)
+bool CoLaBProtocolHandler::receiveChunk()
+{
+  // drop the parsed bytes before appending new ones
+  m_receiveBuffer.erase(m_receiveBuffer.begin(), m_receiveBuffer.begin() + m_receivePos);
+  m_receivePos = 0;
+
+  const int received = m_rTransport.recv(m_chunk, kReceiveChunkSize);
+  if (received <= 0)
   {
-    if (m_rTransport.recv(buffer, 1) < 1)
+    return false;
+  }
+  m_receiveBuffer.insert(m_receiveBuffer.end(), m_chunk.begin(), m_chunk.begin() + received);
+  return true;
+}
+
+bool CoLaBProtocolHandler::ensureReceived(size_t count)
+{
+  while (m_receiveBuffer.size() - m_receivePos < count)
+  {
+    if (!receiveChunk())
     {
-      break;
+      return false;
     }
-    if (0x02 == buffer[0])
+  }
+  return true;
+}
+
+bool CoLaBProtocolHandler::receiveFrame(std::vector<std::uint8_t>& payload)
+{
+  const uint8_t MAGIC_BYTE = 0x02;
+
+  // skip everything up to 4 STx in a row
+  size_t stxRecv = 0;
+  while (stxRecv < 4)
+  {
+    if (!ensureReceived(1))
     {
-      stxRecv++;
+      return false;
     }
-    else
+    const std::vector<std::uint8_t>::const_iterator begin = m_receiveBuffer.begin() + m_receivePos;
+    const std::vector<std::uint8_t>::const_iterator end = m_receiveBuffer.end();
+    std::vector<std::uint8_t>::const_iterator it = begin;
+    while (it != end && stxRecv < 4)
     {
-      stxRecv = 0;
+      stxRecv = (*it == MAGIC_BYTE) ? stxRecv + 1 : 0;
+      ++it;
     }
+    m_receivePos += it - begin;
   }
-  buffer.clear();
 
-  if (stxRecv == 4)
+  // get length, packetlength is only the data without STx, Packet Length and Checksum
+  if (!ensureReceived(sizeof(uint32_t)))
   {
-    // get length
-    m_rTransport.read(buffer, sizeof(uint32_t));
-    const uint32_t length = readUnalignBigEndian<uint32_t>(buffer.data()) + 1; // packetlength is only the data without STx, Packet Length and Checksum, add Checksum to get end of data
-    buffer.clear();
-    m_rTransport.read(buffer, length);
+    return false;
   }
+  const uint32_t length = readUnalignBigEndian<uint32_t>(&m_receiveBuffer[m_receivePos]);
+  m_receivePos += sizeof(uint32_t);
 
-  CoLaCommand response(buffer);
-  return response;
+  // get data and checksum
+  if (!ensureReceived(static_cast<size_t>(length) + 1))
+  {
+    return false;
+  }
+  const std::vector<std::uint8_t>::const_iterator data = m_receiveBuffer.begin() + m_receivePos;
+  payload.assign(data, data + length);
+  const uint8_t checksum = m_receiveBuffer[m_receivePos + length];
+  m_receivePos += static_cast<size_t>(length) + 1;
+
+  uint8_t calculated = 0;
+  for (size_t i = 0; i < payload.size(); i++)
+  {
+    calculated ^= payload[i];
+  }
+  return calculated == checksum;
 }
 
 uint8_t CoLaBProtocolHandler::calculateChecksum(const std::vector<uint8_t>& buffer)
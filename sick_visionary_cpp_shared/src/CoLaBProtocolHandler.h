@@ -24,12 +24,29 @@ public:
   bool openSession(uint8_t sessionTimeout /*secs*/);
   void closeSession();
 
-  // send cola cmd and receive cola response
-  CoLaCommand send(CoLaCommand cmd);
+  void buildFrame(const std::vector<uint8_t>& request, std::vector<uint8_t>& frame);
+  bool sendFrame(std::vector<uint8_t>& frame);
+  uint16_t getRequestId(const std::vector<uint8_t>& frame) const;
+  bool receiveResponse(std::vector<uint8_t>& response, uint16_t& reqId);
+
+  /// Number of bytes requested from the transport at once
+  static const size_t kReceiveChunkSize = 4096;
 
 private:
   ITransport& m_rTransport;
+  // Kept between commands to avoid allocations
+  std::vector<std::uint8_t> m_chunk;
+  // Received bytes not parsed yet start at m_receivePos
+  std::vector<std::uint8_t> m_receiveBuffer;
+  size_t m_receivePos;
+
   uint8_t calculateChecksum(const std::vector<uint8_t>& buffer);
+  // receive the next chunk into the receive buffer, returns false on network errors
+  bool receiveChunk();
+  // receive until at least count bytes are not parsed yet
+  bool ensureReceived(size_t count);
+  // find the next frame and verify its checksum, payload is the data without STx, length and checksum
+  bool receiveFrame(std::vector<std::uint8_t>& payload);
 };
 
 }
@@ -9,6 +9,7 @@
 #include "CoLaCommand.h"
 
 #include <string>
+#include <utility>
 #include "VisionaryEndian.h"
 
 namespace visionary 
@@ -25,16 +26,16 @@ CoLaCommand::CoLaCommand(CoLaCommandType::Enum commandType, CoLaError::Enum erro
 }
 
 CoLaCommand::CoLaCommand(std::vector<uint8_t> buffer)
-  : m_buffer(buffer)
+  : m_buffer(std::move(buffer))
   , m_type(CoLaCommandType::UNKNOWN)
   , m_name("")
   , m_parameterOffset(0)
   , m_error(CoLaError::OK)
 {
   // Read type from header
-  if (buffer.size() < 3)
+  if (m_buffer.size() < 3)
     return;
-  std::string typeStr(reinterpret_cast<char*>(&buffer[0]), 3);
+  std::string typeStr(reinterpret_cast<const char*>(&m_buffer[0]), 3);
   if (typeStr.compare("sRN") == 0) m_type = CoLaCommandType::READ_VARIABLE;
   else if (typeStr.compare("sRA") == 0) m_type = CoLaCommandType::READ_VARIABLE_RESPONSE;
   else if (typeStr.compare("sWN") == 0) m_type = CoLaCommandType::WRITE_VARIABLE;
@@ -48,7 +49,7 @@ CoLaCommand::CoLaCommand(std::vector<uint8_t> buffer)
     m_parameterOffset = 3; // sFA
 
     // Read error code
-    m_error = static_cast<CoLaError::Enum>((static_cast<uint16_t>(buffer[m_parameterOffset]) << 8) | buffer[m_parameterOffset + 1]);
+    m_error = static_cast<CoLaError::Enum>((static_cast<uint16_t>(m_buffer[m_parameterOffset]) << 8) | m_buffer[m_parameterOffset + 1]);
   }
   else if (m_type == CoLaCommandType::NETWORK_ERROR)
   {
@@ -57,11 +58,11 @@ CoLaCommand::CoLaCommand(std::vector<uint8_t> buffer)
   else if (m_type != CoLaCommandType::UNKNOWN)
   {
     // Find name and parameter start
-    for (size_t i = 4; i < buffer.size(); i++)
+    for (size_t i = 4; i < m_buffer.size(); i++)
     {
-      if (buffer.at(i) == ' ')
+      if (m_buffer.at(i) == ' ')
       {
-        m_name = std::string(reinterpret_cast<const char*>(&buffer[4]), i - 4);
+        m_name = std::string(reinterpret_cast<const char*>(&m_buffer[4]), i - 4);
         m_parameterOffset = i + 1; // Skip space
         break;
       }
@@ -69,31 +70,76 @@ CoLaCommand::CoLaCommand(std::vector<uint8_t> buffer)
   }
 }
 
+CoLaCommand::CoLaCommand(const CoLaCommand& other)
+  : m_buffer(other.m_buffer)
+  , m_type(other.m_type)
+  , m_name(other.m_name)
+  , m_parameterOffset(other.m_parameterOffset)
+  , m_error(other.m_error)
+{
+}
+
+CoLaCommand::CoLaCommand(CoLaCommand&& other)
+  : m_buffer(std::move(other.m_buffer))
+  , m_type(other.m_type)
+  , m_name(std::move(other.m_name))
+  , m_parameterOffset(other.m_parameterOffset)
+  , m_error(other.m_error)
+{
+}
+
 CoLaCommand::~CoLaCommand()
 {
 }
 
-const std::vector<uint8_t>& CoLaCommand::getBuffer()
+CoLaCommand& CoLaCommand::operator=(const CoLaCommand& other)
+{
+  m_buffer = other.m_buffer;
+  m_type = other.m_type;
+  m_name = other.m_name;
+  m_parameterOffset = other.m_parameterOffset;
+  m_error = other.m_error;
+  return *this;
+}
+
+CoLaCommand& CoLaCommand::operator=(CoLaCommand&& other)
+{
+  m_buffer = std::move(other.m_buffer);
+  m_type = other.m_type;
+  m_name = std::move(other.m_name);
+  m_parameterOffset = other.m_parameterOffset;
+  m_error = other.m_error;
+  return *this;
+}
+
+const std::vector<uint8_t>& CoLaCommand::getBuffer() const
 {
   return m_buffer;
 }
 
-const CoLaCommandType::Enum CoLaCommand::getType()
+std::vector<uint8_t> CoLaCommand::releaseBuffer()
+{
+  std::vector<uint8_t> buffer;
+  buffer.swap(m_buffer);
+  return buffer;
+}
+
+const CoLaCommandType::Enum CoLaCommand::getType() const
 {
   return m_type;
 }
 
-const char* CoLaCommand::getName()
+const char* CoLaCommand::getName() const
 {
   return m_name.c_str();
 }
 
-size_t CoLaCommand::getParameterOffset()
+size_t CoLaCommand::getParameterOffset() const
 {
   return m_parameterOffset;
 }
 
-CoLaError::Enum CoLaCommand::getError()
+CoLaError::Enum CoLaCommand::getError() const
 {
   return m_error;
 }
@@ -30,24 +30,33 @@ private:
   CoLaCommand(CoLaCommandType::Enum commandType, CoLaError::Enum error, const char* name);
 
 public:
-  /// <summary>Construct a new <see cref="CoLaCommand" /> from the given data buffer.</summary>
+  /// <summary>Construct a new <see cref="CoLaCommand" /> from the given data buffer.
+  /// Pass a temporary or use std::move to hand the buffer over without copying it.</summary>
   CoLaCommand(std::vector<uint8_t> buffer);
+  CoLaCommand(const CoLaCommand& other);
+  CoLaCommand(CoLaCommand&& other);
   ~CoLaCommand();
 
+  CoLaCommand& operator=(const CoLaCommand& other);
+  CoLaCommand& operator=(CoLaCommand&& other);
+
   /// <summary>Get the binary data buffer.</summary>
-  const std::vector<uint8_t>& getBuffer();
+  const std::vector<uint8_t>& getBuffer() const;
+
+  /// <summary>Move the binary data buffer out of the command, the buffer of the command is empty afterwards.</summary>
+  std::vector<uint8_t> releaseBuffer();
 
   /// <summary>Get the type of command.</summary>
-  const CoLaCommandType::Enum getType();
+  const CoLaCommandType::Enum getType() const;
 
   /// <summary>Get the name of command.</summary>
-  const char* getName();
+  const char* getName() const;
 
   /// <summary>Get offset in bytes to where first parameter starts.</summary>
-  size_t getParameterOffset();
+  size_t getParameterOffset() const;
 
   /// <summary>Get error.</summary>
-  CoLaError::Enum getError();
+  CoLaError::Enum getError() const;
 
   /// <summary>Create a command for network errors.</summary>
   static CoLaCommand networkErrorCommand();
@@ -12,10 +12,20 @@
 namespace visionary 
 {
 
-CoLaParameterReader::CoLaParameterReader(CoLaCommand command)
-  : m_command(command)
+CoLaParameterReader::CoLaParameterReader(const CoLaCommand& command)
+  : m_ownedBuffer()
+  , m_pData(command.getBuffer().data())
+  , m_parameterOffset(command.getParameterOffset())
+  , m_currentPosition(m_parameterOffset)
+{
+}
+
+CoLaParameterReader::CoLaParameterReader(CoLaCommand&& command)
+  : m_ownedBuffer(command.releaseBuffer())
+  , m_pData(m_ownedBuffer.data())
+  , m_parameterOffset(command.getParameterOffset())
+  , m_currentPosition(m_parameterOffset)
 {
-  m_currentPosition = command.getParameterOffset();
 }
 
 CoLaParameterReader::~CoLaParameterReader()
@@ -24,61 +34,61 @@ CoLaParameterReader::~CoLaParameterReader()
 
 void CoLaParameterReader::rewind()
 {
-  m_currentPosition = m_command.getParameterOffset();
+  m_currentPosition = m_parameterOffset;
 }
 
 const int8_t CoLaParameterReader::readSInt()
 {
-  const int8_t value = static_cast<const int8_t>(m_command.getBuffer()[m_currentPosition]);
+  const int8_t value = static_cast<const int8_t>(m_pData[m_currentPosition]);
   m_currentPosition += 1;
   return value;
 }
 
 const uint8_t CoLaParameterReader::readUSInt()
 {
-  const uint8_t value = m_command.getBuffer()[m_currentPosition];
+  const uint8_t value = m_pData[m_currentPosition];
   m_currentPosition += 1;
   return value;
 }
 
 const int16_t CoLaParameterReader::readInt()
 {
-  const int16_t value = readUnalignBigEndian<int16_t>(&m_command.getBuffer()[m_currentPosition]);
+  const int16_t value = readUnalignBigEndian<int16_t>(m_pData + m_currentPosition);
   m_currentPosition += 2;
   return value;
 }
 
 const uint16_t CoLaParameterReader::readUInt()
 {
-  const uint16_t value = readUnalignBigEndian<uint16_t>(&m_command.getBuffer()[m_currentPosition]);
+  const uint16_t value = readUnalignBigEndian<uint16_t>(m_pData + m_currentPosition);
   m_currentPosition += 2;
   return value;
 }
 
 const int32_t CoLaParameterReader::readDInt()
 {
-  const int32_t value = readUnalignBigEndian<int32_t>(&m_command.getBuffer()[m_currentPosition]);
+  const int32_t value = readUnalignBigEndian<int32_t>(m_pData + m_currentPosition);
   m_currentPosition += 4;
   return value;
 }
 
 const uint32_t CoLaParameterReader::readUDInt()
 {
-  const uint32_t value = readUnalignBigEndian<uint32_t>(&m_command.getBuffer()[m_currentPosition]);
+  const uint32_t value = readUnalignBigEndian<uint32_t>(m_pData + m_currentPosition);
   m_currentPosition += 4;
   return value;
 }
 
 const float CoLaParameterReader::readReal()
 {
-  const float value = readUnalignBigEndian<float>(&m_command.getBuffer()[m_currentPosition]);
+  const float value = readUnalignBigEndian<float>(m_pData + m_currentPosition);
   m_currentPosition += 4;
   return value;
 }
 
 const double CoLaParameterReader::readLReal()
 {
-  const double value = readUnalignBigEndian<double>(&m_command.getBuffer()[m_currentPosition]);
+  const double value = readUnalignBigEndian<double>(m_pData + m_currentPosition);
   m_currentPosition += 8;
   return value;
 }
@@ -94,7 +104,7 @@ std::string CoLaParameterReader::readFlexString()
   uint16_t len = readUInt();
   if (len)
   {
-    str = std::string(reinterpret_cast<const char*>(&m_command.getBuffer()[m_currentPosition]), len);
+    str = std::string(reinterpret_cast<const char*>(m_pData + m_currentPosition), len);
   }
   m_currentPosition += str.length();
   return str;
@@ -8,24 +8,40 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include "CoLaCommand.h"
+#include "VisionaryEndian.h"
 
 namespace visionary 
 {
 
 /// <summary>
 /// Class for reading data from a <see cref="CoLaCommand" />.
+/// The reader is a view of the command's buffer, only a temporary command is taken over by the reader.
 /// </summary>
 class CoLaParameterReader
 {
 private:
-  CoLaCommand m_command;
+  // Buffer of a temporary command, empty if the reader is a view of the caller's command
+  std::vector<uint8_t> m_ownedBuffer;
+  const uint8_t* m_pData;
+  size_t m_parameterOffset;
   size_t m_currentPosition;
 
+  // No copies, m_pData may point into m_ownedBuffer
+  CoLaParameterReader(const CoLaParameterReader&);
+  const CoLaParameterReader& operator=(const CoLaParameterReader&);
+
 public:
-  CoLaParameterReader(CoLaCommand command);
+  /// <summary>Read from a command without copying it, the command has to outlive the reader.</summary>
+  CoLaParameterReader(const CoLaCommand& command);
+
+  /// <summary>Read from a temporary command, its buffer is moved into the reader.</summary>
+  CoLaParameterReader(CoLaCommand&& command);
   ~CoLaParameterReader();
 
   /// <summary>
@@ -82,6 +98,18 @@ public:
   /// Read a flex string, and advance position according to string size.
   /// </summary>
   std::string readFlexString();
+
+  /// <summary>
+  /// Read count values of a fixed size number type in one pass, e.g. uint16_t for an array of UInt,
+  /// and advance the position by count times the size of the type.
+  /// </summary>
+  template <typename T>
+  void readArray(T* values, size_t count)
+  {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Only numbers are read as arrays");
+    readBigEndianArray<T>(m_pData + m_currentPosition, values, count);
+    m_currentPosition += count * sizeof(T);
+  }
 };
 
 }
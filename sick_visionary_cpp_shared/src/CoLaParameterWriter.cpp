@@ -8,6 +8,8 @@
 
 #include "CoLaParameterWriter.h"
 
+#include <cstring>
+#include <utility>
 #include "MD5.h"
 #include "VisionaryEndian.h"
 
@@ -18,6 +20,8 @@ CoLaParameterWriter::CoLaParameterWriter(CoLaCommandType::Enum type, const char
   : m_type(type)
   , m_name(name)
 {
+  // Type, name and the parameters of most commands fit without growing the buffer
+  m_buffer.reserve(4u + std::strlen(name) + 1u + kReservedParameterSize);
   writeHeader(m_type, m_name);
 }
 
@@ -155,12 +159,13 @@ CoLaParameterWriter& CoLaParameterWriter::operator<<(const bool boolean)
   return parameterBool(boolean);
 }
 
-const CoLaCommand CoLaParameterWriter::build()
+CoLaCommand CoLaParameterWriter::build()
 {
-  // Copy buffer
-  std::vector<uint8_t> buffer = m_buffer;
+  // Hand the buffer over to the command
+  std::vector<uint8_t> buffer;
+  buffer.swap(m_buffer);
 
-  return CoLaCommand(buffer);
+  return CoLaCommand(std::move(buffer));
 }
 
 void CoLaParameterWriter::writeHeader(CoLaCommandType::Enum type, const char* name)
@@ -27,6 +27,9 @@ private:
   const char* m_name;
   std::vector<uint8_t> m_buffer;
 
+  // Bytes reserved for parameters in addition to the header
+  static const size_t kReservedParameterSize = 64u;
+
 public:
   /// <summary>
   /// Construct a new <see cref="CoLaParameterWriter" />.
@@ -177,7 +180,11 @@ public:
   /// <returns>This builder.</returns>
   CoLaParameterWriter& operator<<(const bool boolean);
 
-  const CoLaCommand build();
+  /// <summary>
+  /// Build the command. The buffer is moved into the command, so the writer is empty afterwards.
+  /// </summary>
+  /// <returns>The command.</returns>
+  CoLaCommand build();
 
 private:
   void writeHeader(CoLaCommandType::Enum type, const char* name);
@@ -0,0 +1,264 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "CoLaCommand.h"
+#include "CoLaVariable.h"
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Field of a fixed size CoLa type, decoded into the member of record type S, e.g.
+/// CoLaField&lt;Message, uint32_t, &amp;Message::errorId&gt; for a UDInt. The wire type follows from the member type
+/// like for <see cref="CoLaVariable" />.
+/// </summary>
+template <typename S, typename T, T S::*Member>
+struct CoLaField
+{
+  /// Bytes the field takes at least, the size of fixed size fields is exact
+  static const size_t kMinSize = CoLaValueType<T>::kSize;
+  static const bool kFixedSize = true;
+
+  static bool decode(const uint8_t*& pData, const uint8_t* /*pEnd*/, S& record)
+  {
+    // the bounds of fixed size fields are checked for the whole record
+    record.*Member = CoLaValueType<T>::decode(pData);
+    pData += kMinSize;
+    return true;
+  }
+};
+
+/// <summary>
+/// Flex string field, a UInt length followed by the characters.
+/// </summary>
+template <typename S, std::string S::*Member>
+struct CoLaFlexStringField
+{
+  static const size_t kMinSize = 2u;
+  static const bool kFixedSize = false;
+
+  static bool decode(const uint8_t*& pData, const uint8_t* pEnd, S& record)
+  {
+    const size_t length = readUnalignBigEndian<uint16_t>(pData);
+    pData += kMinSize;
+    if (static_cast<size_t>(pEnd - pData) < length)
+    {
+      return false;
+    }
+    (record.*Member).assign(reinterpret_cast<const char*>(pData), length);
+    pData += length;
+    return true;
+  }
+};
+
+/// <summary>
+/// Array of N values of a fixed size number type, decoded into an array member T[N] of record type S in one pass.
+/// </summary>
+template <typename S, typename T, size_t N, T (S::*Member)[N]>
+struct CoLaArrayField
+{
+  static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Only numbers are decoded as arrays");
+  static const size_t kMinSize = N * sizeof(T);
+  static const bool kFixedSize = true;
+
+  static bool decode(const uint8_t*& pData, const uint8_t* /*pEnd*/, S& record)
+  {
+    readBigEndianArray<T>(pData, record.*Member, N);
+    pData += kMinSize;
+    return true;
+  }
+};
+
+/// <summary>
+/// Nested struct field, decoded by the <see cref="CoLaStructDecoder" /> Decoder of the member type.
+/// </summary>
+template <typename S, typename Decoder, typename Decoder::RecordType S::*Member>
+struct CoLaStructField
+{
+  static const size_t kMinSize = Decoder::kMinSize;
+  static const bool kFixedSize = Decoder::kFixedSize;
+
+  static bool decode(const uint8_t*& pData, const uint8_t* pEnd, S& record)
+  {
+    return Decoder::decodeFields(pData, pEnd, record.*Member);
+  }
+};
+
+/// <summary>
+/// List of the fields of a record, in the order they are on the wire.
+/// </summary>
+template <typename S, typename... Fields>
+struct CoLaFieldList;
+
+template <typename S>
+struct CoLaFieldList<S>
+{
+  static const size_t kMinSize = 0u;
+  static const bool kFixedSize = true;
+
+  static bool decode(const uint8_t*& /*pData*/, const uint8_t* /*pEnd*/, S& /*record*/)
+  {
+    return true;
+  }
+};
+
+template <typename S, typename Field, typename... Rest>
+struct CoLaFieldList<S, Field, Rest...>
+{
+  static const size_t kMinSize = Field::kMinSize + CoLaFieldList<S, Rest...>::kMinSize;
+  static const bool kFixedSize = Field::kFixedSize && CoLaFieldList<S, Rest...>::kFixedSize;
+
+  static bool decode(const uint8_t*& pData, const uint8_t* pEnd, S& record)
+  {
+    if (!Field::decode(pData, pEnd, record))
+    {
+      return false;
+    }
+    // the record was checked for its minimum size, after a variable size field the rest is checked again
+    if (!Field::kFixedSize && static_cast<size_t>(pEnd - pData) < CoLaFieldList<S, Rest...>::kMinSize)
+    {
+      return false;
+    }
+    return CoLaFieldList<S, Rest...>::decode(pData, pEnd, record);
+  }
+};
+
+/// <summary>
+/// Decodes CoLa structs and arrays of structs into C++ records. The fields are listed once at compile time:
+///
+///   typedef CoLaStructDecoder&lt;ErrTime,
+///     CoLaField&lt;ErrTime, uint16_t, &amp;ErrTime::pwrOnCount&gt;,
+///     CoLaField&lt;ErrTime, uint32_t, &amp;ErrTime::opSecs&gt; &gt; ErrTimeDecoder;
+///
+/// The remaining size is checked once per record against the size of all fields, and again after each variable
+/// size field. Every field is read with a single big endian load, arrays of numbers in bulk.
+/// </summary>
+template <typename S, typename... Fields>
+class CoLaStructDecoder
+{
+public:
+  typedef S RecordType;
+  typedef CoLaFieldList<S, Fields...> FieldList;
+
+  /// Bytes a record takes at least, exactly if kFixedSize
+  static const size_t kMinSize = FieldList::kMinSize;
+  static const bool kFixedSize = FieldList::kFixedSize;
+
+  /// <summary>Decode a record at pData and advance pData behind it.</summary>
+  /// <returns>Returns false if the record does not fit up to pEnd</returns>
+  static bool decode(const uint8_t*& pData, const uint8_t* pEnd, S& record)
+  {
+    if (static_cast<size_t>(pEnd - pData) < kMinSize)
+    {
+      return false;
+    }
+    return FieldList::decode(pData, pEnd, record);
+  }
+
+  /// <summary>Decode the fields without checking the size, used for nested structs which the outer
+  /// record checked already.</summary>
+  static bool decodeFields(const uint8_t*& pData, const uint8_t* pEnd, S& record)
+  {
+    return FieldList::decode(pData, pEnd, record);
+  }
+
+  /// <summary>Decode a record from the parameters of a response.</summary>
+  /// <returns>Returns false if the response is an error or too short</returns>
+  static bool decode(const CoLaCommand& response, S& record)
+  {
+    const uint8_t* pData;
+    const uint8_t* pEnd;
+    if (!getParameters(response, pData, pEnd))
+    {
+      return false;
+    }
+    return decode(pData, pEnd, record);
+  }
+
+  /// <summary>Decode an array with a fixed number of records from the parameters of a response.
+  /// The capacity of records is reused.</summary>
+  /// <returns>Returns false if the response is an error or too short, records holds what was decoded</returns>
+  static bool decodeArray(const CoLaCommand& response, size_t count, std::vector<S>& records)
+  {
+    records.clear();
+    const uint8_t* pData;
+    const uint8_t* pEnd;
+    if (!getParameters(response, pData, pEnd))
+    {
+      return false;
+    }
+    // arrays of fixed size records are checked once for all records
+    if (kFixedSize && static_cast<size_t>(pEnd - pData) / (kMinSize > 0u ? kMinSize : 1u) < count)
+    {
+      return false;
+    }
+    records.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+      if (!decode(pData, pEnd, records[i]))
+      {
+        records.resize(i);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// <summary>Decode an array with its UInt length in front from the parameters of a response.</summary>
+  /// <returns>Returns false if the response is an error or too short, records holds what was decoded</returns>
+  static bool decodeFlexArray(const CoLaCommand& response, std::vector<S>& records)
+  {
+    records.clear();
+    const uint8_t* pData;
+    const uint8_t* pEnd;
+    if (!getParameters(response, pData, pEnd) || pEnd - pData < 2)
+    {
+      return false;
+    }
+    const size_t count = readUnalignBigEndian<uint16_t>(pData);
+    pData += 2;
+    // a damaged count does not reserve more records than fit
+    const size_t fitting = static_cast<size_t>(pEnd - pData) / (kMinSize > 0u ? kMinSize : 1u);
+    records.reserve(count < fitting ? count : fitting);
+    for (size_t i = 0; i < count; i++)
+    {
+      records.push_back(S());
+      if (!decode(pData, pEnd, records.back()))
+      {
+        records.pop_back();
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  static bool getParameters(const CoLaCommand& response, const uint8_t*& pData, const uint8_t*& pEnd)
+  {
+    const std::vector<uint8_t>& buffer = response.getBuffer();
+    if (response.getError() != CoLaError::OK || response.getParameterOffset() == 0u
+      || response.getParameterOffset() > buffer.size())
+    {
+      return false;
+    }
+    pData = buffer.data() + response.getParameterOffset();
+    pEnd = buffer.data() + buffer.size();
+    return true;
+  }
+};
+
+}
@@ -0,0 +1,156 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Encoding of a fixed size CoLa value, big endian on the wire.
+/// </summary>
+template <typename T>
+struct CoLaNumericType
+{
+  static const size_t kSize = sizeof(T);
+
+  static void encode(uint8_t* pDest, T value)
+  {
+    writeUnalignBigEndian<T>(pDest, value);
+  }
+
+  static T decode(const uint8_t* pSrc)
+  {
+    return readUnalignBigEndian<T>(pSrc);
+  }
+};
+
+/// <summary>
+/// Wire type of a C++ type. Only the types listed below are defined, so a variable of any other type does not compile.
+/// </summary>
+template <typename T>
+struct CoLaValueType;
+
+template <> struct CoLaValueType<int8_t>   : CoLaNumericType<int8_t>   {}; // SInt
+template <> struct CoLaValueType<uint8_t>  : CoLaNumericType<uint8_t>  {}; // USInt
+template <> struct CoLaValueType<int16_t>  : CoLaNumericType<int16_t>  {}; // Int
+template <> struct CoLaValueType<uint16_t> : CoLaNumericType<uint16_t> {}; // UInt
+template <> struct CoLaValueType<int32_t>  : CoLaNumericType<int32_t>  {}; // DInt
+template <> struct CoLaValueType<uint32_t> : CoLaNumericType<uint32_t> {}; // UDInt
+template <> struct CoLaValueType<float>    : CoLaNumericType<float>    {}; // Real
+template <> struct CoLaValueType<double>   : CoLaNumericType<double>   {}; // LReal
+
+template <>
+struct CoLaValueType<bool> // Bool
+{
+  static const size_t kSize = 1u;
+
+  static void encode(uint8_t* pDest, bool value)
+  {
+    *pDest = value ? 1u : 0u;
+  }
+
+  static bool decode(const uint8_t* pSrc)
+  {
+    return *pSrc == 1u;
+  }
+};
+
+/// <summary>
+/// Descriptor of a device variable with a fixed type, e.g. CoLaVariable&lt;uint32_t&gt;("framePeriodTime").
+/// The request bytes are built once when the descriptor is constructed, reading and writing only encodes and decodes
+/// the value. Use the "SOPAS Communication Interface Description" PDF to determine the type of a variable.
+/// </summary>
+template <typename T>
+class CoLaVariable
+{
+public:
+  typedef T ValueType;
+
+  explicit CoLaVariable(const char* name)
+    : m_name(name)
+  {
+    const size_t nameLength = std::strlen(name);
+
+    // "sRN <name>"
+    m_readRequest.reserve(4u + nameLength);
+    appendString(m_readRequest, "sRN ");
+    appendString(m_readRequest, name);
+
+    // "sRA <name> " precedes the value in the response
+    m_readResponsePrefix = m_readRequest;
+    m_readResponsePrefix[2] = 'A';
+    m_readResponsePrefix.push_back(' ');
+
+    // "sWN <name> " precedes the value in the request
+    m_writePrefix = m_readRequest;
+    m_writePrefix[1] = 'W';
+    m_writePrefix.push_back(' ');
+  }
+
+  const std::string& getName() const
+  {
+    return m_name;
+  }
+
+  /// <summary>Command buffer reading the variable.</summary>
+  const std::vector<uint8_t>& getReadRequest() const
+  {
+    return m_readRequest;
+  }
+
+  /// <summary>Build the command buffer writing a value. The capacity of request is reused.</summary>
+  void encodeWrite(const T& value, std::vector<uint8_t>& request) const
+  {
+    request.assign(m_writePrefix.begin(), m_writePrefix.end());
+    request.resize(m_writePrefix.size() + CoLaValueType<T>::kSize);
+    CoLaValueType<T>::encode(&request[m_writePrefix.size()], value);
+  }
+
+  /// <summary>Decode the response to the read request.</summary>
+  /// <returns>Returns false if the response is an error or too short</returns>
+  bool decodeRead(const std::vector<uint8_t>& response, T& value) const
+  {
+    const size_t prefixSize = m_readResponsePrefix.size();
+    if (response.size() < prefixSize + CoLaValueType<T>::kSize
+      || std::memcmp(response.data(), m_readResponsePrefix.data(), prefixSize) != 0)
+    {
+      return false;
+    }
+    value = CoLaValueType<T>::decode(&response[prefixSize]);
+    return true;
+  }
+
+  /// <summary>Check the response to a write request.</summary>
+  /// <returns>Returns false if the device did not acknowledge the write</returns>
+  bool decodeWrite(const std::vector<uint8_t>& response) const
+  {
+    return response.size() >= 3u && std::memcmp(response.data(), "sWA", 3u) == 0;
+  }
+
+private:
+  static void appendString(std::vector<uint8_t>& buffer, const char* str)
+  {
+    buffer.insert(buffer.end(), str, str + std::strlen(str));
+  }
+
+  std::string m_name;
+  std::vector<uint8_t> m_readRequest;
+  std::vector<uint8_t> m_readResponsePrefix;
+  std::vector<uint8_t> m_writePrefix;
+};
+
+}
@@ -0,0 +1,383 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "DepthMapCodec.h"
+
+#include <algorithm>
+
+#include "ParallelFor.h"
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+static const uint32_t codecMagic = 0x31434D44u; // "DMC1" in little endian
+static const size_t codecHeaderWords = 4;
+// Largest map in pixels, 4096 x 4096 is far above the resolution of the devices.
+// Damaged data cannot make decode allocate more.
+static const uint64_t maxPixels = 1u << 24;
+
+// Writes the variable length code: 3 bits of the value per nibble, the fourth bit tells if more nibbles follow.
+// The nibbles fill the words from the most significant end.
+class NibbleWriter
+{
+public:
+  explicit NibbleWriter(std::vector<uint32_t>& words)
+    : m_words(words)
+    , m_word(0)
+    , m_nibbles(0)
+  {
+  }
+
+  void write(uint32_t value)
+  {
+    do
+    {
+      uint32_t nibble = value & 0x7u;
+      value >>= 3;
+      if (value != 0)
+      {
+        nibble |= 0x8u;
+      }
+      m_word = (m_word << 4) | nibble;
+      if (++m_nibbles == 8)
+      {
+        m_words.push_back(m_word);
+        m_word = 0;
+        m_nibbles = 0;
+      }
+    } while (value != 0);
+  }
+
+  void flush()
+  {
+    if (m_nibbles != 0)
+    {
+      m_words.push_back(m_word << (4 * (8 - m_nibbles)));
+      m_word = 0;
+      m_nibbles = 0;
+    }
+  }
+
+private:
+  std::vector<uint32_t>& m_words;
+  uint32_t m_word;
+  int m_nibbles;
+};
+
+// Reads the code written by NibbleWriter. Reading past the end of the data sets the error flag and returns 0.
+// Most differences of neighbouring pixels fit into one nibble, so that case is kept short.
+class NibbleReader
+{
+public:
+  NibbleReader(const uint8_t* pData, size_t numWords)
+    : m_pData(pData)
+    , m_pEnd(pData + numWords * sizeof(uint32_t))
+    , m_word(0)
+    , m_nibbles(0)
+    , m_error(false)
+  {
+  }
+
+  inline uint32_t read()
+  {
+    if (m_nibbles == 0 && !nextWord())
+    {
+      return 0;
+    }
+    const uint32_t nibble = m_word >> 28;
+    m_word <<= 4;
+    --m_nibbles;
+    if ((nibble & 0x8u) == 0)
+    {
+      return nibble;
+    }
+    return readContinued(nibble & 0x7u);
+  }
+
+  bool hasError() const
+  {
+    return m_error;
+  }
+
+private:
+  bool nextWord()
+  {
+    if (m_pData == m_pEnd)
+    {
+      m_error = true;
+      return false;
+    }
+    m_word = readUnalignLittleEndian<uint32_t>(m_pData);
+    m_pData += sizeof(uint32_t);
+    m_nibbles = 8;
+    return true;
+  }
+
+  // Reads the remaining nibbles of a value longer than one nibble
+  uint32_t readContinued(uint32_t value)
+  {
+    int shift = 3;
+    uint32_t nibble;
+    do
+    {
+      if (m_nibbles == 0 && !nextWord())
+      {
+        return 0;
+      }
+      nibble = m_word >> 28;
+      m_word <<= 4;
+      --m_nibbles;
+      // Values of more than 32 bit can only come from damaged data
+      if (shift > 30)
+      {
+        m_error = true;
+        return 0;
+      }
+      value |= (nibble & 0x7u) << shift;
+      shift += 3;
+    } while (nibble & 0x8u);
+    return value;
+  }
+
+  const uint8_t* m_pData;
+  const uint8_t* m_pEnd;
+  uint32_t m_word;
+  int m_nibbles;
+  bool m_error;
+};
+
+static void encodeTile(const uint16_t* pMap, size_t numPixels, std::vector<uint32_t>& words)
+{
+  words.clear();
+  NibbleWriter writer(words);
+  const uint16_t* pEnd = pMap + numPixels;
+  int previous = 0;
+  while (pMap != pEnd)
+  {
+    uint32_t zeros = 0;
+    for (; pMap != pEnd && *pMap == 0; ++pMap)
+    {
+      ++zeros;
+    }
+    writer.write(zeros);
+
+    uint32_t nonZeros = 0;
+    for (const uint16_t* p = pMap; p != pEnd && *p != 0; ++p)
+    {
+      ++nonZeros;
+    }
+    writer.write(nonZeros);
+
+    for (uint32_t i = 0; i < nonZeros; ++i, ++pMap)
+    {
+      const int current = *pMap;
+      const int delta = current - previous;
+      // Zigzag code, small negative and positive differences get small codes
+      writer.write(static_cast<uint32_t>((delta << 1) ^ (delta >> 31)));
+      previous = current;
+    }
+  }
+  writer.flush();
+}
+
+static bool decodeTile(const uint8_t* pData, size_t numWords, uint16_t* pMap, size_t numPixels)
+{
+  NibbleReader reader(pData, numWords);
+  uint16_t* pEnd = pMap + numPixels;
+  int previous = 0;
+  while (pMap != pEnd)
+  {
+    const uint32_t zeros = reader.read();
+    if (reader.hasError() || zeros > static_cast<size_t>(pEnd - pMap))
+    {
+      return false;
+    }
+    std::fill(pMap, pMap + zeros, uint16_t(0));
+    pMap += zeros;
+    if (pMap == pEnd)
+    {
+      // The encoder always writes the count of valid pixels after the zeros, which is 0 here
+      reader.read();
+      break;
+    }
+
+    const uint32_t nonZeros = reader.read();
+    if (reader.hasError() || nonZeros > static_cast<size_t>(pEnd - pMap))
+    {
+      return false;
+    }
+    for (uint32_t i = 0; i < nonZeros; ++i)
+    {
+      const uint32_t positive = reader.read();
+      const int delta = static_cast<int>(positive >> 1) ^ -static_cast<int>(positive & 1u);
+      const int current = previous + delta;
+      *pMap++ = static_cast<uint16_t>(current);
+      previous = current;
+    }
+    if (reader.hasError())
+    {
+      return false;
+    }
+  }
+  return !reader.hasError();
+}
+
+DepthMapCodec::DepthMapCodec()
+  : m_numThreads(0)
+  , m_tileRows(16)
+{
+}
+
+DepthMapCodec::~DepthMapCodec()
+{
+}
+
+void DepthMapCodec::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+void DepthMapCodec::setTileRows(int tileRows)
+{
+  m_tileRows = (tileRows < 1) ? 1 : tileRows;
+}
+
+bool DepthMapCodec::encode(const std::vector<uint16_t>& map, int width, int height, std::vector<uint8_t>& encoded)
+{
+  if (width <= 0 || height <= 0 || map.size() != static_cast<size_t>(width) * static_cast<size_t>(height)
+    || map.size() > maxPixels)
+  {
+    return false;
+  }
+  const size_t tileRows = static_cast<size_t>(m_tileRows);
+  const size_t numTiles = (static_cast<size_t>(height) + tileRows - 1) / tileRows;
+  const size_t tilePixels = tileRows * static_cast<size_t>(width);
+  if (m_tileWords.size() < numTiles)
+  {
+    m_tileWords.resize(numTiles);
+  }
+
+  const uint16_t* pMap = map.data();
+  const size_t numPixels = map.size();
+  std::vector<uint32_t>* pTileWords = m_tileWords.data();
+  parallelFor(numTiles, m_numThreads, [=](size_t tileBegin, size_t tileEnd)
+  {
+    for (size_t tile = tileBegin; tile < tileEnd; ++tile)
+    {
+      const size_t first = tile * tilePixels;
+      const size_t count = (numPixels - first < tilePixels) ? numPixels - first : tilePixels;
+      encodeTile(pMap + first, count, pTileWords[tile]);
+    }
+  });
+
+  //-----------------------------------------------
+  // Header with the tile sizes, then the tiles
+  size_t totalWords = codecHeaderWords + numTiles;
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    totalWords += m_tileWords[tile].size();
+  }
+  encoded.resize(totalWords * sizeof(uint32_t));
+  uint8_t* pOut = encoded.data();
+  writeUnalignLittleEndian<uint32_t>(pOut, codecMagic);
+  writeUnalignLittleEndian<uint32_t>(pOut + 4, static_cast<uint32_t>(width));
+  writeUnalignLittleEndian<uint32_t>(pOut + 8, static_cast<uint32_t>(height));
+  writeUnalignLittleEndian<uint32_t>(pOut + 12, static_cast<uint32_t>(tileRows));
+  pOut += codecHeaderWords * sizeof(uint32_t);
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    writeUnalignLittleEndian<uint32_t>(pOut, static_cast<uint32_t>(m_tileWords[tile].size()));
+    pOut += sizeof(uint32_t);
+  }
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    const std::vector<uint32_t>& words = m_tileWords[tile];
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+      writeUnalignLittleEndian<uint32_t>(pOut, words[i]);
+      pOut += sizeof(uint32_t);
+    }
+  }
+  return true;
+}
+
+bool DepthMapCodec::decode(const std::vector<uint8_t>& encoded, std::vector<uint16_t>& map, int& width, int& height)
+{
+  return decode(encoded.data(), encoded.size(), map, width, height);
+}
+
+bool DepthMapCodec::decode(const uint8_t* encoded, size_t size, std::vector<uint16_t>& map, int& width, int& height)
+{
+  if (size < codecHeaderWords * sizeof(uint32_t) || readUnalignLittleEndian<uint32_t>(encoded) != codecMagic)
+  {
+    return false;
+  }
+  const uint32_t encodedWidth = readUnalignLittleEndian<uint32_t>(encoded + 4);
+  const uint32_t encodedHeight = readUnalignLittleEndian<uint32_t>(encoded + 8);
+  // The encoder writes the rows per tile it was set to, which may be more than the height
+  const uint32_t tileRows = std::min(readUnalignLittleEndian<uint32_t>(encoded + 12), encodedHeight);
+  // The size of the map comes from the data, it is checked before anything is allocated
+  if (encodedWidth == 0 || encodedHeight == 0 || tileRows == 0
+    || static_cast<uint64_t>(encodedWidth) * encodedHeight > maxPixels)
+  {
+    return false;
+  }
+  const size_t numTiles = (static_cast<size_t>(encodedHeight) + tileRows - 1) / tileRows;
+  const size_t sizeWords = size / sizeof(uint32_t);
+  if (numTiles > sizeWords - codecHeaderWords)
+  {
+    return false;
+  }
+
+  // Start of each tile, checked against the size of the data before anything is decoded
+  std::vector<size_t> tileOffsets(numTiles + 1);
+  const uint8_t* pSizes = encoded + codecHeaderWords * sizeof(uint32_t);
+  tileOffsets[0] = codecHeaderWords + numTiles;
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    // The encoder writes at least one word per tile
+    const uint32_t tileWords = readUnalignLittleEndian<uint32_t>(pSizes + tile * sizeof(uint32_t));
+    tileOffsets[tile + 1] = tileOffsets[tile] + tileWords;
+    if (tileWords == 0 || tileOffsets[tile + 1] > sizeWords)
+    {
+      return false;
+    }
+  }
+
+  map.resize(static_cast<size_t>(encodedWidth) * encodedHeight);
+  const size_t numPixels = map.size();
+  const size_t tilePixels = static_cast<size_t>(tileRows) * encodedWidth;
+  uint16_t* pMap = map.data();
+  const size_t* pOffsets = tileOffsets.data();
+  std::vector<uint8_t> tileOk(numTiles, 0);
+  uint8_t* pTileOk = tileOk.data();
+  parallelFor(numTiles, m_numThreads, [=](size_t tileBegin, size_t tileEnd)
+  {
+    for (size_t tile = tileBegin; tile < tileEnd; ++tile)
+    {
+      const size_t first = tile * tilePixels;
+      const size_t count = (numPixels - first < tilePixels) ? numPixels - first : tilePixels;
+      pTileOk[tile] = decodeTile(encoded + pOffsets[tile] * sizeof(uint32_t), pOffsets[tile + 1] - pOffsets[tile],
+                                 pMap + first, count) ? 1u : 0u;
+    }
+  });
+
+  for (size_t tile = 0; tile < numTiles; ++tile)
+  {
+    if (!tileOk[tile])
+    {
+      return false;
+    }
+  }
+  width = static_cast<int>(encodedWidth);
+  height = static_cast<int>(encodedHeight);
+  return true;
+}
+
+}
@@ -0,0 +1,70 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace visionary
+{
+
+/// <summary>
+/// Lossless codec for distance and Z maps (e.g. VisionaryTData::getDistanceMap()) to record or forward them
+/// with less disk space and bandwidth.
+/// The map is split into bands of rows (tiles) which are coded independently with RVL
+/// (A. Wilson, "Fast Lossless Depth Image Compression", 2017): runs of invalid (0) pixels are stored as counts,
+/// valid pixels as the difference to the previous valid pixel in a variable length code of 4 bit nibbles.
+/// The tiles are encoded and decoded in parallel.
+///
+/// Layout of the encoded data, all values are 32 bit little endian:
+/// magic "DMC1", width, height, rows per tile, number of words of each tile, followed by the words of all tiles.
+/// </summary>
+class DepthMapCodec
+{
+public:
+  DepthMapCodec();
+  ~DepthMapCodec();
+
+  /// <summary>Set the number of threads the tiles are split on, 0 uses one thread per hardware thread.
+  /// The default is 0.</summary>
+  void setNumThreads(unsigned numThreads);
+
+  /// <summary>Set the number of image rows of a tile. Smaller tiles give more parallelism, larger tiles a bit
+  /// better compression. The default is 16.</summary>
+  void setTileRows(int tileRows);
+
+  /// <summary>Encode a map.</summary>
+  /// <param name="map">Map to encode, width x height pixels</param>
+  /// <param name="width">Width of the map in pixels</param>
+  /// <param name="height">Height of the map in pixels</param>
+  /// <param name="encoded">Encoded data, resized to the encoded size</param>
+  /// <returns>Returns false if the size of map does not match width x height or is more than 4096 x 4096 pixels</returns>
+  bool encode(const std::vector<uint16_t>& map, int width, int height, std::vector<uint8_t>& encoded);
+
+  /// <summary>Decode a map encoded by encode().</summary>
+  /// <param name="encoded">Encoded data</param>
+  /// <param name="size">Size of the encoded data in bytes</param>
+  /// <param name="map">Decoded map, resized to width x height</param>
+  /// <param name="width">Width of the decoded map</param>
+  /// <param name="height">Height of the decoded map</param>
+  /// <returns>Returns false if the data is no encoded map, is damaged or the map has more than 4096 x 4096 pixels</returns>
+  bool decode(const uint8_t* encoded, size_t size, std::vector<uint16_t>& map, int& width, int& height);
+
+  /// <summary>Same as above for the data of a vector.</summary>
+  bool decode(const std::vector<uint8_t>& encoded, std::vector<uint16_t>& map, int& width, int& height);
+
+private:
+  unsigned m_numThreads;
+  int m_tileRows;
+  // Encoded words of each tile, kept to avoid allocations for the next frame
+  std::vector<std::vector<uint32_t> > m_tileWords;
+};
+
+}
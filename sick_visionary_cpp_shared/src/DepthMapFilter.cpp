@@ -0,0 +1,304 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "DepthMapFilter.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "ParallelFor.h"
+
+namespace visionary
+{
+
+// The kernels process the columns of a row in blocks of this size. Each window position of a block is
+// gathered into a separate lane, so the kernels are simple loops over the lanes which the compiler vectorizes.
+static const int filterBlockSize = 64;
+static const int maxMedianWindow = 5 * 5;
+static const int maxBilateralRadius = 3;
+
+static inline bool isValidDepth(uint16_t value)
+{
+  return (value != 0) & (value != uint16_t(0xFFFF));
+}
+
+DepthMapFilter::DepthMapFilter()
+  : m_numThreads(1)
+  , m_median3x3(3 * 3, (3 * 3) / 2)
+  , m_median5x5(5 * 5, (5 * 5) / 2)
+{
+}
+
+DepthMapFilter::~DepthMapFilter()
+{
+}
+
+bool DepthMapFilter::addMedian(int windowSize)
+{
+  if (windowSize != 3 && windowSize != 5)
+  {
+    return false;
+  }
+  Stage stage;
+  stage.type = MEDIAN;
+  stage.radius = windowSize / 2;
+  stage.invSigmaRange2 = 0.0f;
+  stage.maxJump = 0;
+  m_stages.push_back(stage);
+  return true;
+}
+
+bool DepthMapFilter::addBilateral(int radius, float sigmaSpatial, float sigmaRange)
+{
+  if (radius < 1 || radius > maxBilateralRadius || !(sigmaSpatial > 0.0f) || !(sigmaRange > 0.0f))
+  {
+    return false;
+  }
+  Stage stage;
+  stage.type = BILATERAL;
+  stage.radius = radius;
+  for (int dy = -radius; dy <= radius; ++dy)
+  {
+    for (int dx = -radius; dx <= radius; ++dx)
+    {
+      stage.spatialWeights.push_back(std::exp(-static_cast<float>(dx * dx + dy * dy) / (2.0f * sigmaSpatial * sigmaSpatial)));
+    }
+  }
+  stage.invSigmaRange2 = 1.0f / (sigmaRange * sigmaRange);
+  stage.maxJump = 0;
+  m_stages.push_back(stage);
+  return true;
+}
+
+void DepthMapFilter::addFlyingPixelRemoval(uint16_t maxJump)
+{
+  Stage stage;
+  stage.type = FLYING_PIXEL;
+  stage.radius = 1;
+  stage.invSigmaRange2 = 0.0f;
+  stage.maxJump = maxJump;
+  m_stages.push_back(stage);
+}
+
+void DepthMapFilter::clear()
+{
+  m_stages.clear();
+}
+
+size_t DepthMapFilter::getStageCount() const
+{
+  return m_stages.size();
+}
+
+void DepthMapFilter::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+bool DepthMapFilter::apply(std::vector<uint16_t>& map, int width, int height)
+{
+  if (width <= 0 || height <= 0 || map.size() != static_cast<size_t>(width) * static_cast<size_t>(height))
+  {
+    return false;
+  }
+
+  for (std::vector<Stage>::const_iterator it = m_stages.begin(); it != m_stages.end(); ++it)
+  {
+    pad(map, width, height, it->radius);
+    switch (it->type)
+    {
+      case MEDIAN:
+        applyMedian(*it, map, width, height);
+        break;
+      case BILATERAL:
+        applyBilateral(*it, map, width, height);
+        break;
+      case FLYING_PIXEL:
+        applyFlyingPixelRemoval(*it, map, width, height);
+        break;
+    }
+  }
+  return true;
+}
+
+void DepthMapFilter::pad(const std::vector<uint16_t>& map, int width, int height, int radius)
+{
+  const int paddedWidth = width + 2 * radius;
+  m_padded.resize(static_cast<size_t>(paddedWidth) * static_cast<size_t>(height + 2 * radius));
+
+  for (int row = -radius; row < height + radius; ++row)
+  {
+    const int srcRow = (row < 0) ? 0 : ((row >= height) ? height - 1 : row);
+    const uint16_t* pSrc = &map[static_cast<size_t>(srcRow) * width];
+    uint16_t* pDst = &m_padded[static_cast<size_t>(row + radius) * paddedWidth];
+    for (int col = 0; col < radius; ++col)
+    {
+      pDst[col] = pSrc[0];
+      pDst[radius + width + col] = pSrc[width - 1];
+    }
+    std::memcpy(pDst + radius, pSrc, width * sizeof(uint16_t));
+  }
+}
+
+void DepthMapFilter::applyMedian(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const
+{
+  const int radius = stage.radius;
+  const int windowWidth = 2 * radius + 1;
+  const int paddedWidth = width + 2 * radius;
+  const SortingNetwork* pNetwork = (radius == 1) ? &m_median3x3 : &m_median5x5;
+  const size_t medianLane = pNetwork->getSize() / 2;
+  const uint16_t* pPadded = m_padded.data();
+  uint16_t* pMap = map.data();
+
+  parallelFor(static_cast<size_t>(height), m_numThreads, [=](size_t rowBegin, size_t rowEnd)
+  {
+    uint16_t lanes[maxMedianWindow * filterBlockSize];
+    for (int row = static_cast<int>(rowBegin); row < static_cast<int>(rowEnd); ++row)
+    {
+      // Row of the padded map where the window of the current pixel starts
+      const uint16_t* pWindow = pPadded + static_cast<size_t>(row) * paddedWidth;
+      uint16_t* pOut = pMap + static_cast<size_t>(row) * width;
+
+      for (int blockBegin = 0; blockBegin < width; blockBegin += filterBlockSize)
+      {
+        const int blockSize = (width - blockBegin < filterBlockSize) ? width - blockBegin : filterBlockSize;
+        const uint16_t* pCentre = pWindow + radius * paddedWidth + radius + blockBegin;
+
+        // Gather the window, invalid neighbours are replaced by the centre so they do not take part
+        for (int dy = 0; dy < windowWidth; ++dy)
+        {
+          for (int dx = 0; dx < windowWidth; ++dx)
+          {
+            const uint16_t* pSrc = pWindow + dy * paddedWidth + dx + blockBegin;
+            uint16_t* pLane = lanes + (dy * windowWidth + dx) * filterBlockSize;
+            for (int i = 0; i < blockSize; ++i)
+            {
+              const uint16_t value = pSrc[i];
+              const uint16_t centre = pCentre[i];
+              pLane[i] = isValidDepth(value) ? value : centre;
+            }
+          }
+        }
+
+        pNetwork->apply(lanes, filterBlockSize, blockSize);
+
+        const uint16_t* pMedian = lanes + medianLane * filterBlockSize;
+        uint16_t* pBlockOut = pOut + blockBegin;
+        for (int i = 0; i < blockSize; ++i)
+        {
+          const uint16_t median = pMedian[i];
+          const uint16_t centre = pCentre[i];
+          pBlockOut[i] = isValidDepth(centre) ? median : centre;
+        }
+      }
+    }
+  });
+}
+
+void DepthMapFilter::applyBilateral(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const
+{
+  const int radius = stage.radius;
+  const int windowWidth = 2 * radius + 1;
+  const int paddedWidth = width + 2 * radius;
+  const float invSigmaRange2 = stage.invSigmaRange2;
+  const float* pSpatialWeights = stage.spatialWeights.data();
+  const uint16_t* pPadded = m_padded.data();
+  uint16_t* pMap = map.data();
+
+  parallelFor(static_cast<size_t>(height), m_numThreads, [=](size_t rowBegin, size_t rowEnd)
+  {
+    float weightedSum[filterBlockSize];
+    float weightSum[filterBlockSize];
+    for (int row = static_cast<int>(rowBegin); row < static_cast<int>(rowEnd); ++row)
+    {
+      const uint16_t* pWindow = pPadded + static_cast<size_t>(row) * paddedWidth;
+      uint16_t* pOut = pMap + static_cast<size_t>(row) * width;
+
+      for (int blockBegin = 0; blockBegin < width; blockBegin += filterBlockSize)
+      {
+        const int blockSize = (width - blockBegin < filterBlockSize) ? width - blockBegin : filterBlockSize;
+        const uint16_t* pCentre = pWindow + radius * paddedWidth + radius + blockBegin;
+        for (int i = 0; i < blockSize; ++i)
+        {
+          weightedSum[i] = 0.0f;
+          weightSum[i] = 0.0f;
+        }
+
+        for (int dy = 0; dy < windowWidth; ++dy)
+        {
+          for (int dx = 0; dx < windowWidth; ++dx)
+          {
+            const uint16_t* pSrc = pWindow + dy * paddedWidth + dx + blockBegin;
+            const float spatialWeight = pSpatialWeights[dy * windowWidth + dx];
+            for (int i = 0; i < blockSize; ++i)
+            {
+              // The range weight 1 / (1 + d^2 / sigma^2) stops smoothing at edges like a Gaussian,
+              // but needs no exp() and so keeps the loop vectorizable
+              const float value = static_cast<float>(pSrc[i]);
+              const float diff = value - static_cast<float>(pCentre[i]);
+              const float weight = spatialWeight / (1.0f + diff * diff * invSigmaRange2);
+              const float usedWeight = isValidDepth(pSrc[i]) ? weight : 0.0f;
+              weightedSum[i] += usedWeight * value;
+              weightSum[i] += usedWeight;
+            }
+          }
+        }
+
+        uint16_t* pBlockOut = pOut + blockBegin;
+        for (int i = 0; i < blockSize; ++i)
+        {
+          // A valid centre always contributes itself, so the weight sum is only zero for invalid centres
+          const float filtered = weightedSum[i] / weightSum[i] + 0.5f;
+          const float value = isValidDepth(pCentre[i]) ? filtered : static_cast<float>(pCentre[i]);
+          pBlockOut[i] = static_cast<uint16_t>(value);
+        }
+      }
+    }
+  });
+}
+
+void DepthMapFilter::applyFlyingPixelRemoval(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const
+{
+  const int paddedWidth = width + 2;
+  const int maxJump = stage.maxJump;
+  const uint16_t* pPadded = m_padded.data();
+  uint16_t* pMap = map.data();
+
+  // Offsets of one neighbour of each opposite pair (horizontal, vertical and both diagonals) relative to the centre
+  const int offsets[4] = { 1, paddedWidth, paddedWidth + 1, paddedWidth - 1 };
+
+  parallelFor(static_cast<size_t>(height), m_numThreads, [=](size_t rowBegin, size_t rowEnd)
+  {
+    for (int row = static_cast<int>(rowBegin); row < static_cast<int>(rowEnd); ++row)
+    {
+      const uint16_t* pCentre = pPadded + static_cast<size_t>(row + 1) * paddedWidth + 1;
+      uint16_t* pOut = pMap + static_cast<size_t>(row) * width;
+
+      for (int col = 0; col < width; ++col)
+      {
+        const int centre = pCentre[col];
+        bool flying = false;
+        for (int k = 0; k < 4; ++k)
+        {
+          const uint16_t a = pCentre[col - offsets[k]];
+          const uint16_t b = pCentre[col + offsets[k]];
+          const int diffA = a - centre;
+          const int diffB = b - centre;
+          // Invalid neighbours do not count as jump
+          const bool jumpA = ((diffA > maxJump) | (diffA < -maxJump)) & isValidDepth(a);
+          const bool jumpB = ((diffB > maxJump) | (diffB < -maxJump)) & isValidDepth(b);
+          flying |= jumpA & jumpB;
+        }
+        // Invalid centres keep their value, 0 and 0xFFFF mean different things
+        pOut[col] = (flying & isValidDepth(pCentre[col])) ? uint16_t(0) : pCentre[col];
+      }
+    }
+  });
+}
+
+}
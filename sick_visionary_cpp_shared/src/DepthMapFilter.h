@@ -0,0 +1,99 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SortingNetwork.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Pipeline of filters for the raw distance or Z maps (e.g. VisionaryTData::getDistanceMap()), applied in place
+/// before the point cloud is generated. The stages run in the order they were added. Invalid pixels (0 and 0xFFFF)
+/// are never used as neighbours and stay invalid, the filters do not fill holes.
+/// </summary>
+class DepthMapFilter
+{
+public:
+  DepthMapFilter();
+  ~DepthMapFilter();
+
+  /// <summary>Add a median filter stage.</summary>
+  /// <param name="windowSize">Size of the quadratic window, 3 or 5</param>
+  /// <returns>Returns false if the window size is not supported</returns>
+  bool addMedian(int windowSize);
+
+  /// <summary>Add an edge preserving bilateral filter stage.</summary>
+  /// <param name="radius">Radius of the window in pixels (1 to 3)</param>
+  /// <param name="sigmaSpatial">Standard deviation of the spatial Gaussian weight in pixels</param>
+  /// <param name="sigmaRange">Scale of the range weight in map units. Neighbours differing by sigmaRange get half
+  /// the weight of neighbours with equal value.</param>
+  /// <returns>Returns false if a parameter is out of range</returns>
+  bool addBilateral(int radius, float sigmaSpatial, float sigmaRange);
+
+  /// <summary>Add a stage removing flying pixels at jump edges. A pixel is set to invalid (0) if it differs
+  /// by more than maxJump from both opposite neighbours along one of the four directions through it,
+  /// i.e. if it lies between foreground and background. Pixels on one side of a real edge are kept.</summary>
+  /// <param name="maxJump">Maximum difference to a neighbour in map units</param>
+  void addFlyingPixelRemoval(uint16_t maxJump);
+
+  /// <summary>Remove all stages.</summary>
+  void clear();
+
+  /// <summary>Number of stages of the pipeline.</summary>
+  size_t getStageCount() const;
+
+  /// <summary>Set the number of threads the image rows are split on, 0 uses one thread per hardware thread.
+  /// The default is 1.</summary>
+  void setNumThreads(unsigned numThreads);
+
+  /// <summary>Run all stages on the map.</summary>
+  /// <param name="map">Distance or Z map, filtered in place</param>
+  /// <param name="width">Width of the map in pixels</param>
+  /// <param name="height">Height of the map in pixels</param>
+  /// <returns>Returns false if the size of map does not match width x height</returns>
+  bool apply(std::vector<uint16_t>& map, int width, int height);
+
+private:
+  enum StageType
+  {
+    MEDIAN,
+    BILATERAL,
+    FLYING_PIXEL
+  };
+
+  struct Stage
+  {
+    StageType type;
+    int radius;
+    // Bilateral weights for the window offsets, row major
+    std::vector<float> spatialWeights;
+    float invSigmaRange2;
+    uint16_t maxJump;
+  };
+
+  // Copy map to m_padded with a border of radius pixels on each side, the border repeats the edge pixels
+  void pad(const std::vector<uint16_t>& map, int width, int height, int radius);
+
+  void applyMedian(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const;
+  void applyBilateral(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const;
+  void applyFlyingPixelRemoval(const Stage& stage, std::vector<uint16_t>& map, int width, int height) const;
+
+  std::vector<Stage> m_stages;
+  unsigned m_numThreads;
+  // Input of the current stage, reused between frames
+  std::vector<uint16_t> m_padded;
+  SortingNetwork m_median3x3;
+  SortingNetwork m_median5x5;
+};
+
+}
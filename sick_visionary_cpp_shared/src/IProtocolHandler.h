@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 #include "CoLaCommand.h"
 
 namespace visionary 
@@ -17,9 +18,28 @@ namespace visionary
 class IProtocolHandler
 {
 public:
+  virtual ~IProtocolHandler() {}
+
   virtual bool openSession(uint8_t sessionTimeout /*secs*/) = 0;
   virtual void closeSession() = 0;
-  virtual CoLaCommand send(CoLaCommand cmd) = 0;
+
+  /// <summary>Build the complete frame of a command buffer once, to send it repeatedly with sendFrame.</summary>
+  virtual void buildFrame(const std::vector<uint8_t>& request, std::vector<uint8_t>& frame) = 0;
+
+  /// <summary>Send a frame built by buildFrame without waiting for the response. Request and session id
+  /// are updated in place where the protocol has them.</summary>
+  /// <returns>False on network errors.</returns>
+  virtual bool sendFrame(std::vector<uint8_t>& frame) = 0;
+
+  /// <summary>Request id a frame was last sent with, 0 for protocols without request ids.
+  /// Their responses arrive in the order of the requests.</summary>
+  virtual uint16_t getRequestId(const std::vector<uint8_t>& frame) const = 0;
+
+  /// <summary>Receive the next response to a frame sent with sendFrame.</summary>
+  /// <param name="response">The response buffer</param>
+  /// <param name="reqId">Request id of the response, 0 for protocols without request ids</param>
+  /// <returns>False on network errors.</returns>
+  virtual bool receiveResponse(std::vector<uint8_t>& response, uint16_t& reqId) = 0;
 };
 
 }
@@ -0,0 +1,64 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "CoLaStructDecoder.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// ErrTimeType of the "SOPAS Communication Interface Description", when a message occurred.
+/// </summary>
+struct ErrTimeType
+{
+  uint16_t pwrOnCount;
+  uint32_t opSecs;
+  uint32_t timeOccur;
+};
+
+/// <summary>
+/// Entry of the info message array MSinfo.
+/// </summary>
+struct InfoMessage
+{
+  uint32_t errorId;
+  uint32_t errorState;
+  ErrTimeType firstTime;
+  ErrTimeType lastTime;
+  uint16_t numberOccurance;
+  uint16_t errReserved;
+  std::string extInfo;
+};
+
+/// Length of the MSinfo array, it always has this many entries
+static const size_t kInfoMessageCount = 25u;
+
+typedef CoLaStructDecoder<ErrTimeType,
+  CoLaField<ErrTimeType, uint16_t, &ErrTimeType::pwrOnCount>,
+  CoLaField<ErrTimeType, uint32_t, &ErrTimeType::opSecs>,
+  CoLaField<ErrTimeType, uint32_t, &ErrTimeType::timeOccur> > ErrTimeTypeDecoder;
+
+/// <summary>
+/// Decodes the read response of MSinfo: InfoMessageDecoder::decodeArray(response, kInfoMessageCount, messages)
+/// </summary>
+typedef CoLaStructDecoder<InfoMessage,
+  CoLaField<InfoMessage, uint32_t, &InfoMessage::errorId>,
+  CoLaField<InfoMessage, uint32_t, &InfoMessage::errorState>,
+  CoLaStructField<InfoMessage, ErrTimeTypeDecoder, &InfoMessage::firstTime>,
+  CoLaStructField<InfoMessage, ErrTimeTypeDecoder, &InfoMessage::lastTime>,
+  CoLaField<InfoMessage, uint16_t, &InfoMessage::numberOccurance>,
+  CoLaField<InfoMessage, uint16_t, &InfoMessage::errReserved>,
+  CoLaFlexStringField<InfoMessage, &InfoMessage::extInfo> > InfoMessageDecoder;
+
+}
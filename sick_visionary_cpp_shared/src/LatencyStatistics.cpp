@@ -0,0 +1,78 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "LatencyStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace visionary
+{
+
+LatencyStatistics::LatencyStatistics()
+  : m_sorted(true)
+  , m_sum(0.0)
+{
+}
+
+LatencyStatistics::~LatencyStatistics()
+{
+}
+
+void LatencyStatistics::add(double value)
+{
+  m_values.push_back(value);
+  m_sorted = false;
+  m_sum += value;
+}
+
+void LatencyStatistics::clear()
+{
+  m_values.clear();
+  m_sorted = true;
+  m_sum = 0.0;
+}
+
+size_t LatencyStatistics::getCount() const
+{
+  return m_values.size();
+}
+
+double LatencyStatistics::getMin() const
+{
+  return getPercentile(0.0);
+}
+
+double LatencyStatistics::getMax() const
+{
+  return getPercentile(100.0);
+}
+
+double LatencyStatistics::getMean() const
+{
+  return m_values.empty() ? 0.0 : m_sum / static_cast<double>(m_values.size());
+}
+
+double LatencyStatistics::getPercentile(double percentile) const
+{
+  if (m_values.empty())
+  {
+    return 0.0;
+  }
+  if (!m_sorted)
+  {
+    std::sort(m_values.begin(), m_values.end());
+    m_sorted = true;
+  }
+  // Nearest rank: the smallest sample with at least percentile % of the samples at or below it
+  const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+  const size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(m_values.size())));
+  return m_values[(rank == 0u) ? 0u : rank - 1u];
+}
+
+}
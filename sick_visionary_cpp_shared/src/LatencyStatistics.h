@@ -0,0 +1,47 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace visionary
+{
+
+/// <summary>
+/// Collects latency samples and reports their distribution. The unit of the samples is up to the caller.
+/// </summary>
+class LatencyStatistics
+{
+public:
+  LatencyStatistics();
+  ~LatencyStatistics();
+
+  void add(double value);
+  void clear();
+
+  size_t getCount() const;
+
+  /// <summary>Smallest, largest and mean sample, 0 if there are none.</summary>
+  double getMin() const;
+  double getMax() const;
+  double getMean() const;
+
+  /// <summary>Nearest rank percentile of the samples, 0 if there are none.</summary>
+  /// <param name="percentile">Percentile from 0 to 100, e.g. 50 for the median</param>
+  double getPercentile(double percentile) const;
+
+private:
+  // Sorted when a percentile is requested, samples added later clear the flag
+  mutable std::vector<double> m_values;
+  mutable bool m_sorted;
+  double m_sum;
+};
+
+}
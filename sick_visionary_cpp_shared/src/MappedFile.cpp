@@ -0,0 +1,152 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace visionary
+{
+
+MappedFile::MappedFile()
+  : m_pData(NULL)
+  , m_size(0)
+#ifdef _WIN32
+  , m_fileHandle(INVALID_HANDLE_VALUE)
+  , m_mappingHandle(NULL)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool MappedFile::isOpen() const
+{
+  return m_pData != NULL;
+}
+
+const uint8_t* MappedFile::getData() const
+{
+  return m_pData;
+}
+
+size_t MappedFile::getSize() const
+{
+  return m_size;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const char* filename)
+{
+  close();
+
+  m_fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (m_fileHandle == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(m_fileHandle, &fileSize) || fileSize.QuadPart == 0
+    || static_cast<unsigned long long>(fileSize.QuadPart) > static_cast<size_t>(-1))
+  {
+    close();
+    return false;
+  }
+  m_mappingHandle = CreateFileMappingA(m_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (m_mappingHandle == NULL)
+  {
+    close();
+    return false;
+  }
+  const void* pView = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+  if (pView == NULL)
+  {
+    close();
+    return false;
+  }
+  m_pData = static_cast<const uint8_t*>(pView);
+  m_size = static_cast<size_t>(fileSize.QuadPart);
+  return true;
+}
+
+void MappedFile::close()
+{
+  if (m_pData != NULL)
+  {
+    UnmapViewOfFile(m_pData);
+    m_pData = NULL;
+    m_size = 0;
+  }
+  if (m_mappingHandle != NULL)
+  {
+    CloseHandle(m_mappingHandle);
+    m_mappingHandle = NULL;
+  }
+  if (m_fileHandle != INVALID_HANDLE_VALUE)
+  {
+    CloseHandle(m_fileHandle);
+    m_fileHandle = INVALID_HANDLE_VALUE;
+  }
+}
+
+#else
+
+bool MappedFile::open(const char* filename)
+{
+  close();
+
+  const int fd = ::open(filename, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  const size_t size = static_cast<size_t>(fileStat.st_size);
+  void* pMapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping stays valid after the file is closed
+  ::close(fd);
+  if (pMapping == MAP_FAILED)
+  {
+    return false;
+  }
+  // Recordings are mostly read from start to end, lets the kernel read ahead
+  posix_madvise(pMapping, size, POSIX_MADV_SEQUENTIAL);
+  m_pData = static_cast<const uint8_t*>(pMapping);
+  m_size = size;
+  return true;
+}
+
+void MappedFile::close()
+{
+  if (m_pData != NULL)
+  {
+    munmap(const_cast<uint8_t*>(m_pData), m_size);
+    m_pData = NULL;
+    m_size = 0;
+  }
+}
+
+#endif
+
+}
@@ -0,0 +1,56 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace visionary
+{
+
+/// <summary>
+/// Read only memory mapping of a whole file. The pages are loaded by the operating system when they are accessed,
+/// so large recordings can be read at disk speed without copying them into buffers first.
+/// </summary>
+class MappedFile
+{
+public:
+  MappedFile();
+  ~MappedFile();
+
+  /// <summary>Map a file, a file mapped before is unmapped.</summary>
+  /// <param name="filename">The file to map</param>
+  /// <returns>Returns false if the file could not be opened or mapped, or is empty</returns>
+  bool open(const char* filename);
+
+  /// <summary>Unmap the file, the pointers returned by getData get invalid.</summary>
+  void close();
+
+  bool isOpen() const;
+
+  /// <summary>Start of the mapped file, NULL if no file is mapped.</summary>
+  const uint8_t* getData() const;
+
+  /// <summary>Size of the mapped file in bytes.</summary>
+  size_t getSize() const;
+
+private:
+  // No copies, the mapping is owned
+  MappedFile(const MappedFile&);
+  const MappedFile& operator=(const MappedFile&);
+
+  const uint8_t* m_pData;
+  size_t m_size;
+#ifdef _WIN32
+  void* m_fileHandle;
+  void* m_mappingHandle;
+#endif
+};
+
+}
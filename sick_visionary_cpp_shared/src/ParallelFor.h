@@ -0,0 +1,61 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace visionary
+{
+
+/// <summary>
+/// Split the range [0, count) into contiguous blocks and process them in parallel.
+/// The calling thread processes the first block itself, the call returns when all blocks are done.
+/// </summary>
+/// <param name="count">Number of items (e.g. image rows) to process.</param>
+/// <param name="numThreads">Number of threads to use, 0 uses one thread per hardware thread.</param>
+/// <param name="fn">Called as fn(begin, end) for each block, must be safe to call concurrently.</param>
+template <typename Fn>
+void parallelFor(size_t count, unsigned numThreads, Fn fn)
+{
+  if (numThreads == 0)
+  {
+    numThreads = std::thread::hardware_concurrency();
+  }
+  if (numThreads > count)
+  {
+    numThreads = static_cast<unsigned>(count);
+  }
+  if (numThreads <= 1)
+  {
+    if (count > 0)
+    {
+      fn(size_t(0), count);
+    }
+    return;
+  }
+
+  const size_t blockSize = (count + numThreads - 1) / numThreads;
+  std::vector<std::thread> workers;
+  workers.reserve(numThreads - 1);
+  for (size_t begin = blockSize; begin < count; begin += blockSize)
+  {
+    const size_t end = (begin + blockSize < count) ? begin + blockSize : count;
+    workers.push_back(std::thread(fn, begin, end));
+  }
+  fn(size_t(0), blockSize);
+
+  for (std::vector<std::thread>::iterator it = workers.begin(); it != workers.end(); ++it)
+  {
+    it->join();
+  }
+}
+
+}
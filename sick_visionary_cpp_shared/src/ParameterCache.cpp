@@ -0,0 +1,190 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "ParameterCache.h"
+#include "CoLaParameterWriter.h"
+
+namespace visionary
+{
+
+ParameterCache::ParameterCache(VisionaryControl& control, Clock::duration timeToLive)
+  : m_rControl(control)
+  , m_timeToLive(timeToLive)
+  , m_generation(0)
+  , m_hasChangeCounter(false)
+  , m_changeCounter(0)
+  , m_hits(0)
+  , m_misses(0)
+  , m_changeInvalidations(0)
+{
+}
+
+ParameterCache::~ParameterCache()
+{
+}
+
+void ParameterCache::setTimeToLive(Clock::duration timeToLive)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_timeToLive = timeToLive;
+  // entries keep the expiry they were stored with
+}
+
+ParameterCache::Clock::duration ParameterCache::getTimeToLive() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_timeToLive;
+}
+
+CoLaCommand ParameterCache::read(const std::string& varname)
+{
+  std::vector<uint8_t> response;
+  uint64_t generation;
+  if (lookup(varname, response, generation))
+  {
+    return CoLaCommand(std::move(response));
+  }
+  CoLaCommand command = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, varname.c_str()).build();
+  CoLaCommand result = m_rControl.sendCommand(command);
+  if (result.getError() == CoLaError::OK && result.getType() == CoLaCommandType::READ_VARIABLE_RESPONSE)
+  {
+    store(varname, result.getBuffer(), generation);
+  }
+  return result;
+}
+
+CoLaCommand ParameterCache::refresh(const std::string& varname)
+{
+  invalidate(varname);
+  return read(varname);
+}
+
+CoLaCommand ParameterCache::write(const CoLaCommand& command)
+{
+  CoLaCommand result = m_rControl.getAsyncClient().send(command).get();
+  if (command.getType() == CoLaCommandType::WRITE_VARIABLE
+    && result.getError() == CoLaError::OK && result.getType() == CoLaCommandType::WRITE_VARIABLE_RESPONSE)
+  {
+    storeWrite(command.getName(), command.getBuffer());
+  }
+  else
+  {
+    invalidate(command.getName());
+  }
+  return result;
+}
+
+void ParameterCache::invalidate(const std::string& varname)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.erase(varname);
+  m_generation++;
+}
+
+void ParameterCache::invalidateAll()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_generation++;
+}
+
+void ParameterCache::updateChangeCounter(uint32_t changeCounter)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_hasChangeCounter && m_changeCounter == changeCounter)
+  {
+    return;
+  }
+  if (m_hasChangeCounter)
+  {
+    m_entries.clear();
+    m_generation++;
+    m_changeInvalidations++;
+  }
+  m_hasChangeCounter = true;
+  m_changeCounter = changeCounter;
+}
+
+uint64_t ParameterCache::getHits() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_hits;
+}
+
+uint64_t ParameterCache::getMisses() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_misses;
+}
+
+uint64_t ParameterCache::getChangeInvalidations() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_changeInvalidations;
+}
+
+void ParameterCache::resetStatistics()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_hits = 0;
+  m_misses = 0;
+  m_changeInvalidations = 0;
+}
+
+bool ParameterCache::lookup(const std::string& varname, std::vector<uint8_t>& response, uint64_t& generation)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  generation = m_generation;
+  std::unordered_map<std::string, Entry>::const_iterator it = m_entries.find(varname);
+  if (it == m_entries.end() || Clock::now() >= it->second.expiry)
+  {
+    m_misses++;
+    return false;
+  }
+  response.assign(it->second.response.begin(), it->second.response.end());
+  m_hits++;
+  return true;
+}
+
+void ParameterCache::store(const std::string& varname, const std::vector<uint8_t>& response, uint64_t generation)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (generation != m_generation)
+  {
+    return;
+  }
+  Entry& entry = m_entries[varname];
+  entry.response.assign(response.begin(), response.end());
+  entry.expiry = Clock::now() + m_timeToLive;
+}
+
+void ParameterCache::storeWrite(const std::string& varname, const std::vector<uint8_t>& writeRequest)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_generation++;
+  // "sWN <name> <value>" becomes "sRA <name> <value>"
+  Entry& entry = m_entries[varname];
+  entry.response.assign(writeRequest.begin(), writeRequest.end());
+  entry.response[1] = 'R';
+  entry.response[2] = 'A';
+  entry.expiry = Clock::now() + m_timeToLive;
+}
+
+std::vector<uint8_t>& ParameterCache::getRequestBuffer()
+{
+  static thread_local std::vector<uint8_t> buffer;
+  return buffer;
+}
+
+std::vector<uint8_t>& ParameterCache::getResponseBuffer()
+{
+  static thread_local std::vector<uint8_t> buffer;
+  return buffer;
+}
+
+}
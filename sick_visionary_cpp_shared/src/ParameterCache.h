@@ -0,0 +1,167 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CoLaCommand.h"
+#include "CoLaVariable.h"
+#include "VisionaryControl.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Caches the read responses of device variables in front of a <see cref="VisionaryControl" />. A read within the
+/// time to live of the cached response does not touch the network. Writes go to the device and update the cache
+/// when the device acknowledges them.
+///
+/// Variables can change on the device without a write through this cache, e.g. by SOPAS ET. Pass the
+/// changeCounter of each received frame to <see cref="updateChangeCounter" /> so the cache is cleared
+/// when the configuration changed, or use <see cref="refresh" /> and <see cref="invalidate" />.
+///
+/// All methods may be called from several threads at once.
+/// </summary>
+class ParameterCache
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  /// <summary>Create a cache for the variables of control.</summary>
+  /// <param name="control">The open control connection, it has to outlive the cache</param>
+  /// <param name="timeToLive">Time a read response is served from the cache</param>
+  ParameterCache(VisionaryControl& control, Clock::duration timeToLive);
+  ~ParameterCache();
+
+  void setTimeToLive(Clock::duration timeToLive);
+  Clock::duration getTimeToLive() const;
+
+  /// <summary>Read a variable, from the cache if possible.</summary>
+  /// <param name="varname">Name of the variable</param>
+  /// <returns>The read response, use a CoLaParameterReader to get the value. Errors are not cached.</returns>
+  CoLaCommand read(const std::string& varname);
+
+  /// <summary>Read a variable described by a <see cref="CoLaVariable" />, from the cache if possible.</summary>
+  /// <returns>True if successful, false otherwise.</returns>
+  template <typename T>
+  bool read(const CoLaVariable<T>& variable, T& value);
+
+  /// <summary>Read a variable from the device and update the cache, regardless of the time to live.</summary>
+  CoLaCommand refresh(const std::string& varname);
+
+  /// <summary>Send a write command built with CoLaParameterWriter. The written value is cached
+  /// if the device acknowledges it.</summary>
+  /// <returns>The write response.</returns>
+  CoLaCommand write(const CoLaCommand& command);
+
+  /// <summary>Write a variable described by a <see cref="CoLaVariable" /> and cache the value
+  /// if the device acknowledges it.</summary>
+  /// <returns>True if the device acknowledged the write, false otherwise.</returns>
+  template <typename T>
+  bool write(const CoLaVariable<T>& variable, const T& value);
+
+  /// <summary>Drop the cached response of a variable.</summary>
+  void invalidate(const std::string& varname);
+
+  /// <summary>Drop all cached responses.</summary>
+  void invalidateAll();
+
+  /// <summary>Drop all cached responses if changeCounter differs from the previous call.
+  /// Call it with VisionaryData::getChangeCounter() after each received frame.</summary>
+  void updateChangeCounter(uint32_t changeCounter);
+
+  /// <summary>Number of reads served from the cache.</summary>
+  uint64_t getHits() const;
+
+  /// <summary>Number of reads which went to the device.</summary>
+  uint64_t getMisses() const;
+
+  /// <summary>Number of times all responses were dropped because the change counter changed.</summary>
+  uint64_t getChangeInvalidations() const;
+
+  void resetStatistics();
+
+private:
+  // No copies, the cache refers to the connection
+  ParameterCache(const ParameterCache&);
+  const ParameterCache& operator=(const ParameterCache&);
+
+  struct Entry
+  {
+    std::vector<uint8_t> response;
+    Clock::time_point expiry;
+  };
+
+  // copy the cached response of varname into response and count the hit or miss. generation is the state
+  // of the cache a response read from the device after a miss belongs to.
+  bool lookup(const std::string& varname, std::vector<uint8_t>& response, uint64_t& generation);
+  // cache a read response, unless a write or invalidation happened since lookup returned generation
+  void store(const std::string& varname, const std::vector<uint8_t>& response, uint64_t generation);
+  // cache the read response equal to an acknowledged write request, which carries the value in the same encoding
+  void storeWrite(const std::string& varname, const std::vector<uint8_t>& writeRequest);
+
+  // Buffers of the templates, one pair per thread to avoid allocations
+  static std::vector<uint8_t>& getRequestBuffer();
+  static std::vector<uint8_t>& getResponseBuffer();
+
+  VisionaryControl& m_rControl;
+
+  mutable std::mutex m_mutex;
+  Clock::duration m_timeToLive;
+  std::unordered_map<std::string, Entry> m_entries;
+  // Counts writes and invalidations, so a slow read does not overwrite what happened meanwhile
+  uint64_t m_generation;
+  bool m_hasChangeCounter;
+  uint32_t m_changeCounter;
+  uint64_t m_hits;
+  uint64_t m_misses;
+  uint64_t m_changeInvalidations;
+};
+
+template <typename T>
+bool ParameterCache::read(const CoLaVariable<T>& variable, T& value)
+{
+  std::vector<uint8_t>& response = getResponseBuffer();
+  uint64_t generation;
+  if (lookup(variable.getName(), response, generation))
+  {
+    return variable.decodeRead(response, value);
+  }
+  if (!m_rControl.getAsyncClient().execute(variable.getReadRequest(), response)
+    || !variable.decodeRead(response, value))
+  {
+    return false;
+  }
+  store(variable.getName(), response, generation);
+  return true;
+}
+
+template <typename T>
+bool ParameterCache::write(const CoLaVariable<T>& variable, const T& value)
+{
+  std::vector<uint8_t>& request = getRequestBuffer();
+  std::vector<uint8_t>& response = getResponseBuffer();
+  variable.encodeWrite(value, request);
+  if (!m_rControl.getAsyncClient().execute(request, response)
+    || !variable.decodeWrite(response))
+  {
+    // the device may have taken the value or not
+    invalidate(variable.getName());
+    return false;
+  }
+  storeWrite(variable.getName(), request);
+  return true;
+}
+
+}
@@ -0,0 +1,179 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "PointCloudNormalEstimator.h"
+
+#include <cmath>
+#include <limits>
+
+#include "ParallelFor.h"
+
+namespace visionary
+{
+
+static const float bad_normal = std::numeric_limits<float>::quiet_NaN();
+static const int normalBlockSize = 64;
+
+// Returns neighbour n if it is valid and not further than sqrt(maxDist2) away from the centre c, the centre otherwise.
+// Comparisons with NaN are false, so invalid neighbours are replaced and an invalid centre stays invalid.
+static inline void selectUsable(const float* pX, const float* pY, const float* pZ, int n, int c, float maxDist2,
+                                float& x, float& y, float& z)
+{
+  const float nx = pX[n];
+  const float ny = pY[n];
+  const float nz = pZ[n];
+  const float cx = pX[c];
+  const float cy = pY[c];
+  const float cz = pZ[c];
+  const float dx = nx - cx;
+  const float dy = ny - cy;
+  const float dz = nz - cz;
+  const bool usable = (dx * dx + dy * dy + dz * dz) <= maxDist2;
+  // Selecting the offset instead of the neighbour keeps the compiler from turning the select into a select
+  // of the load address, which cannot be vectorized.
+  x = cx + (usable ? dx : 0.0f);
+  y = cy + (usable ? dy : 0.0f);
+  z = cz + (usable ? dz : 0.0f);
+}
+
+// Calculates the normal of the centre point c from its left (l), right (r), upper (u) and lower (d) neighbours.
+// Neighbours outside of the image are passed as the centre point itself. Replacing unusable neighbours
+// by the centre gives central differences if both neighbours are usable and one sided differences otherwise.
+// If no neighbour in one direction is usable, the difference vector and with it the cross product is zero.
+// The function contains no branches, so the loops calling it are vectorized by the compiler.
+// The points are passed as separate X, Y and Z planes, on the interleaved points the kernel is not vectorized.
+static inline void normalAt(const float* pX, const float* pY, const float* pZ, int c, int l, int r, int u, int d,
+                            float maxDist2, float& normalX, float& normalY, float& normalZ)
+{
+  float lx, ly, lz, rx, ry, rz, ux, uy, uz, dx, dy, dz;
+  selectUsable(pX, pY, pZ, l, c, maxDist2, lx, ly, lz);
+  selectUsable(pX, pY, pZ, r, c, maxDist2, rx, ry, rz);
+  selectUsable(pX, pY, pZ, u, c, maxDist2, ux, uy, uz);
+  selectUsable(pX, pY, pZ, d, c, maxDist2, dx, dy, dz);
+
+  const float hx = rx - lx;
+  const float hy = ry - ly;
+  const float hz = rz - lz;
+  const float vx = dx - ux;
+  const float vy = dy - uy;
+  const float vz = dz - uz;
+
+  const float nx = hy * vz - hz * vy;
+  const float ny = hz * vx - hx * vz;
+  const float nz = hx * vy - hy * vx;
+  const float len2 = nx * nx + ny * ny + nz * nz;
+
+  // Orient the normal towards the origin, i.e. against the direction of the point
+  const float orientation = ((nx * pX[c] + ny * pY[c] + nz * pZ[c]) > 0.0f) ? -1.0f : 1.0f;
+  const float invLength = orientation / std::sqrt(len2);
+  // A zero length normal (no usable neighbours) or a NaN (invalid centre) gives an invalid normal
+  const float scale = (len2 > 0.0f) ? invLength : bad_normal;
+
+  normalX = nx * scale;
+  normalY = ny * scale;
+  normalZ = nz * scale;
+}
+
+bool PointCloudNormalEstimator::estimateNormals(const std::vector<PointXYZ>& points, int width, int height, std::vector<PointXYZ>& normals,
+                                                int neighbourDistance, float maxNeighbourDistance, unsigned numThreads)
+{
+  if (width <= 0 || height <= 0 || points.size() != static_cast<size_t>(width) * static_cast<size_t>(height))
+  {
+    return false;
+  }
+  normals.resize(points.size());
+
+  const int k = (neighbourDistance < 1) ? 1 : neighbourDistance;
+  const float maxDist2 = (maxNeighbourDistance > 0.0f) ? maxNeighbourDistance * maxNeighbourDistance
+                                                      : std::numeric_limits<float>::infinity();
+
+  //-----------------------------------------------
+  // Split the points into planes
+  std::vector<float> planeX(points.size());
+  std::vector<float> planeY(points.size());
+  std::vector<float> planeZ(points.size());
+  const PointXYZ* pPoints = points.data();
+  float* pX = planeX.data();
+  float* pY = planeY.data();
+  float* pZ = planeZ.data();
+  parallelFor(points.size(), numThreads, [=](size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      pX[i] = pPoints[i].x;
+      pY[i] = pPoints[i].y;
+      pZ[i] = pPoints[i].z;
+    }
+  });
+
+  //-----------------------------------------------
+  // Columns closer than k to the left or right border have only one horizontal neighbour
+  const int interiorBegin = (k < width) ? k : width;
+  const int interiorEnd = (width > interiorBegin + k) ? width - k : interiorBegin;
+  PointXYZ* pNormals = normals.data();
+
+  // Captured by value, references into the closure would be reloaded after every store to the normals
+  parallelFor(static_cast<size_t>(height), numThreads, [=](size_t rowBegin, size_t rowEnd)
+  {
+    for (int row = static_cast<int>(rowBegin); row < static_cast<int>(rowEnd); ++row)
+    {
+      // All indices are relative to the start of the current row. Rows outside of the image are replaced by the centre row.
+      const size_t rowStart = static_cast<size_t>(row) * static_cast<size_t>(width);
+      const float* rX = pX + rowStart;
+      const float* rY = pY + rowStart;
+      const float* rZ = pZ + rowStart;
+      const int up = (row >= k) ? -k * width : 0;
+      const int down = (row + k < height) ? k * width : 0;
+      PointXYZ* pN = pNormals + rowStart;
+
+      for (int col = 0; col < interiorBegin; ++col)
+      {
+        const int right = (col + k < width) ? col + k : col;
+        normalAt(rX, rY, rZ, col, col, right, col + up, col + down, maxDist2, pN[col].x, pN[col].y, pN[col].z);
+      }
+      // The interior is processed in blocks through local buffers. The buffers cannot alias the planes, which saves
+      // the compiler from checking the output against every neighbour at runtime before vectorizing the loop.
+      for (int blockBegin = interiorBegin; blockBegin < interiorEnd; blockBegin += normalBlockSize)
+      {
+        const int blockSize = (interiorEnd - blockBegin < normalBlockSize) ? interiorEnd - blockBegin : normalBlockSize;
+        float blockX[normalBlockSize];
+        float blockY[normalBlockSize];
+        float blockZ[normalBlockSize];
+        for (int i = 0; i < blockSize; ++i)
+        {
+          const int col = blockBegin + i;
+          normalAt(rX, rY, rZ, col, col - k, col + k, col + up, col + down, maxDist2, blockX[i], blockY[i], blockZ[i]);
+        }
+        PointXYZ* pBlock = pN + blockBegin;
+        for (int i = 0; i < blockSize; ++i)
+        {
+          pBlock[i].x = blockX[i];
+          pBlock[i].y = blockY[i];
+          pBlock[i].z = blockZ[i];
+        }
+      }
+      for (int col = interiorEnd; col < width; ++col)
+      {
+        const int left = (col >= k) ? col - k : col;
+        normalAt(rX, rY, rZ, col, left, col, col + up, col + down, maxDist2, pN[col].x, pN[col].y, pN[col].z);
+      }
+    }
+  });
+
+  return true;
+}
+
+PointCloudNormalEstimator::PointCloudNormalEstimator()
+{
+}
+
+PointCloudNormalEstimator::~PointCloudNormalEstimator()
+{
+}
+
+}
@@ -0,0 +1,51 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <vector>
+
+#include "PointXYZ.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Class for estimating surface normals of organized point clouds as produced by VisionaryData::generatePointCloud.
+/// Instead of searching nearest neighbours the image grid is used: the normal of a point is the cross product
+/// of the difference vectors to its horizontal and vertical neighbours.
+/// </summary>
+class PointCloudNormalEstimator
+{
+public:
+
+  /// <summary>Estimate the normal of each point of an organized point cloud.</summary>
+  /// <param name="points">Organized point cloud (row major, width x height), invalid points are NaN</param>
+  /// <param name="width">Width of the point cloud in points</param>
+  /// <param name="height">Height of the point cloud in points</param>
+  /// <param name="normals">Unit normals in the same organized layout as points, oriented towards the origin of the
+  /// point cloud coordinate system (the camera for clouds which are not transformed). Normals of points without
+  /// valid neighbours are NaN.</param>
+  /// <param name="neighbourDistance">Distance in pixels to the neighbours used, larger values give smoother normals</param>
+  /// <param name="maxNeighbourDistance">Neighbours further away than this distance (in units of the point cloud) are
+  /// treated as invalid, which avoids normals across depth discontinuities. 0 disables the check.</param>
+  /// <param name="numThreads">Number of threads to use, 0 uses one thread per hardware thread</param>
+  /// <returns>Returns false if the size of points does not match width x height</returns>
+  static bool estimateNormals(const std::vector<PointXYZ>& points, int width, int height, std::vector<PointXYZ>& normals,
+                              int neighbourDistance = 1, float maxNeighbourDistance = 0.0f, unsigned numThreads = 0);
+
+private:
+
+  // No instantiations
+  PointCloudNormalEstimator();
+  virtual ~PointCloudNormalEstimator();
+  const PointCloudNormalEstimator& operator=(const PointCloudNormalEstimator&);
+  PointCloudNormalEstimator(const PointCloudNormalEstimator&);
+};
+
+}
@@ -0,0 +1,568 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "PointCloudPlyReader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "ParallelFor.h"
+
+namespace visionary
+{
+
+// Ascii data is split into chunks of at least this many bytes, smaller chunks are not worth a thread
+static const size_t plyMinAsciiChunkSize = 64 * 1024;
+
+// All properties of one vertex, properties missing in the file are 0
+struct PlyVertex
+{
+  float x, y, z;
+  uint8_t red, green, blue;
+  float intensity;
+};
+
+static uint16_t intensityToMapValue(float intensity)
+{
+  const float value = intensity * 65535.0f + 0.5f;
+  return (value <= 0.0f) ? uint16_t(0) : (value >= 65535.0f) ? uint16_t(65535) : static_cast<uint16_t>(value);
+}
+
+//-----------------------------------------------
+// Destinations of the vertices, set() is called concurrently for different indices
+
+struct PointMapSink
+{
+  PointXYZ* pPoints;
+  uint32_t* pRgba;
+  uint16_t* pIntensity;
+
+  void set(size_t index, const PlyVertex& vertex) const
+  {
+    pPoints[index].x = vertex.x;
+    pPoints[index].y = vertex.y;
+    pPoints[index].z = vertex.z;
+    if (pRgba != NULL)
+    {
+      const uint8_t rgba[4] = { vertex.red, vertex.green, vertex.blue, 255u };
+      std::memcpy(pRgba + index, rgba, sizeof(rgba));
+    }
+    if (pIntensity != NULL)
+    {
+      pIntensity[index] = intensityToMapValue(vertex.intensity);
+    }
+  }
+};
+
+struct RgbPointSink
+{
+  PointXYZRGB* pPoints;
+
+  void set(size_t index, const PlyVertex& vertex) const
+  {
+    PointXYZRGB& point = pPoints[index];
+    point.x = vertex.x;
+    point.y = vertex.y;
+    point.z = vertex.z;
+    point.r = vertex.red;
+    point.g = vertex.green;
+    point.b = vertex.blue;
+    point.a = 255u;
+  }
+};
+
+struct IntensityPointSink
+{
+  PointXYZI* pPoints;
+
+  void set(size_t index, const PlyVertex& vertex) const
+  {
+    PointXYZI& point = pPoints[index];
+    point.x = vertex.x;
+    point.y = vertex.y;
+    point.z = vertex.z;
+    point.intensity = static_cast<float>(intensityToMapValue(vertex.intensity));
+  }
+};
+
+//-----------------------------------------------
+// Ascii parsing. The mapped data is not terminated, so all functions take the end of the line.
+
+static inline const char* skipBlanks(const char* p, const char* pEnd)
+{
+  while (p != pEnd && (*p == ' ' || *p == '\t' || *p == '\r'))
+  {
+    ++p;
+  }
+  return p;
+}
+
+static inline bool isDigit(char c)
+{
+  return static_cast<unsigned>(c - '0') < 10u;
+}
+
+// Parses a decimal float as written by PointCloudPlyWriter (e.g. "-1.25", "0.001", "1e+07").
+// Anything else, like "nan" or "inf", is left to strtod. Returns NULL if no number was found.
+static const char* parseFloat(const char* p, const char* pEnd, float& value)
+{
+  static const double powers[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+  p = skipBlanks(p, pEnd);
+  const char* pStart = p;
+  const bool negative = (p != pEnd && *p == '-');
+  if (p != pEnd && (*p == '-' || *p == '+'))
+  {
+    ++p;
+  }
+
+  uint64_t mantissa = 0;
+  int numDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  for (; p != pEnd && isDigit(*p); ++p)
+  {
+    hasDigits = true;
+    if (numDigits < 19)
+    {
+      mantissa = mantissa * 10u + static_cast<unsigned>(*p - '0');
+      numDigits += (mantissa != 0) ? 1 : 0;
+    }
+    else
+    {
+      ++exponent;
+    }
+  }
+  if (p != pEnd && *p == '.')
+  {
+    for (++p; p != pEnd && isDigit(*p); ++p)
+    {
+      hasDigits = true;
+      if (numDigits < 19)
+      {
+        mantissa = mantissa * 10u + static_cast<unsigned>(*p - '0');
+        numDigits += (mantissa != 0) ? 1 : 0;
+        --exponent;
+      }
+    }
+  }
+  if (hasDigits && p != pEnd && (*p == 'e' || *p == 'E'))
+  {
+    const char* pExponent = p + 1;
+    const bool negativeExponent = (pExponent != pEnd && *pExponent == '-');
+    if (pExponent != pEnd && (*pExponent == '-' || *pExponent == '+'))
+    {
+      ++pExponent;
+    }
+    if (pExponent != pEnd && isDigit(*pExponent))
+    {
+      int exponentValue = 0;
+      for (; pExponent != pEnd && isDigit(*pExponent); ++pExponent)
+      {
+        exponentValue = std::min(exponentValue * 10 + (*pExponent - '0'), 100000);
+      }
+      exponent += negativeExponent ? -exponentValue : exponentValue;
+      p = pExponent;
+    }
+  }
+
+  if (hasDigits && exponent >= -22 && exponent <= 22)
+  {
+    double result = static_cast<double>(mantissa);
+    result = (exponent < 0) ? result / powers[-exponent] : result * powers[exponent];
+    value = static_cast<float>(negative ? -result : result);
+    return p;
+  }
+
+  // Rare cases, the token is copied to terminate it
+  char token[64];
+  size_t length = 0;
+  for (p = pStart; p != pEnd && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && length + 1 < sizeof(token); ++p)
+  {
+    token[length++] = *p;
+  }
+  token[length] = '\0';
+  char* pTokenEnd = NULL;
+  const double result = std::strtod(token, &pTokenEnd);
+  if (length == 0 || pTokenEnd != token + length)
+  {
+    return NULL;
+  }
+  value = static_cast<float>(result);
+  return p;
+}
+
+static const char* parseByte(const char* p, const char* pEnd, uint8_t& value)
+{
+  p = skipBlanks(p, pEnd);
+  unsigned result = 0;
+  const char* pStart = p;
+  for (; p != pEnd && isDigit(*p) && result <= 255u; ++p)
+  {
+    result = result * 10u + static_cast<unsigned>(*p - '0');
+  }
+  if (p == pStart || result > 255u)
+  {
+    return NULL;
+  }
+  value = static_cast<uint8_t>(result);
+  return p;
+}
+
+// Parses one vertex line without its line end
+static bool parseVertexLine(const char* p, const char* pEnd, bool hasColors, bool hasIntensities, PlyVertex& vertex)
+{
+  p = parseFloat(p, pEnd, vertex.x);
+  p = (p != NULL) ? parseFloat(p, pEnd, vertex.y) : NULL;
+  p = (p != NULL) ? parseFloat(p, pEnd, vertex.z) : NULL;
+  if (hasColors)
+  {
+    p = (p != NULL) ? parseByte(p, pEnd, vertex.red) : NULL;
+    p = (p != NULL) ? parseByte(p, pEnd, vertex.green) : NULL;
+    p = (p != NULL) ? parseByte(p, pEnd, vertex.blue) : NULL;
+  }
+  if (hasIntensities)
+  {
+    p = (p != NULL) ? parseFloat(p, pEnd, vertex.intensity) : NULL;
+  }
+  return (p != NULL) && (skipBlanks(p, pEnd) == pEnd);
+}
+
+//-----------------------------------------------
+
+PointCloudPlyReader::PointCloudPlyReader()
+  : m_numThreads(0)
+  , m_pointCount(0)
+  , m_isBinary(false)
+  , m_hasColors(false)
+  , m_hasIntensities(false)
+  , m_vertexOffset(0)
+  , m_stride(0)
+  , m_colorOffset(0)
+  , m_intensityOffset(0)
+{
+}
+
+PointCloudPlyReader::~PointCloudPlyReader()
+{
+}
+
+void PointCloudPlyReader::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+bool PointCloudPlyReader::open(const char* filename)
+{
+  close();
+  if (!m_file.open(filename) || !parseHeader())
+  {
+    close();
+    return false;
+  }
+  return true;
+}
+
+void PointCloudPlyReader::close()
+{
+  m_file.close();
+  m_pointCount = 0;
+  m_isBinary = false;
+  m_hasColors = false;
+  m_hasIntensities = false;
+  m_vertexOffset = 0;
+  m_stride = 0;
+}
+
+size_t PointCloudPlyReader::getPointCount() const
+{
+  return m_pointCount;
+}
+
+bool PointCloudPlyReader::isBinary() const
+{
+  return m_isBinary;
+}
+
+bool PointCloudPlyReader::hasColors() const
+{
+  return m_hasColors;
+}
+
+bool PointCloudPlyReader::hasIntensities() const
+{
+  return m_hasIntensities;
+}
+
+bool PointCloudPlyReader::parseHeader()
+{
+  const char* pData = reinterpret_cast<const char*>(m_file.getData());
+  const char* pEnd = pData + m_file.getSize();
+
+  // Header lines without line ends and comments
+  std::vector<std::string> lines;
+  const char* pLine = pData;
+  for (;;)
+  {
+    const char* pLineEnd = static_cast<const char*>(std::memchr(pLine, '\n', static_cast<size_t>(pEnd - pLine)));
+    if (pLineEnd == NULL)
+    {
+      return false;
+    }
+    std::string line(pLine, pLineEnd);
+    pLine = pLineEnd + 1;
+    if (!line.empty() && line[line.size() - 1] == '\r')
+    {
+      line.erase(line.size() - 1);
+    }
+    if (line.compare(0, 8, "comment ") == 0)
+    {
+      continue;
+    }
+    if (line == "end_header")
+    {
+      break;
+    }
+    lines.push_back(line);
+  }
+  m_vertexOffset = static_cast<size_t>(pLine - pData);
+
+  if (lines.size() < 6 || lines[0] != "ply" || lines[2].compare(0, 15, "element vertex ") != 0)
+  {
+    return false;
+  }
+  if (lines[1] == "format binary_little_endian 1.0")
+  {
+    m_isBinary = true;
+  }
+  else if (lines[1] != "format ascii 1.0")
+  {
+    return false;
+  }
+  char* pCountEnd = NULL;
+  const char* pCount = lines[2].c_str() + 15;
+  const unsigned long long pointCount = std::strtoull(pCount, &pCountEnd, 10);
+  if (pCountEnd == pCount || *pCountEnd != '\0')
+  {
+    return false;
+  }
+
+  // Properties in the order PointCloudPlyWriter writes them
+  size_t line = 3;
+  if (lines[line++] != "property float x" || lines[line++] != "property float y" || lines[line++] != "property float z")
+  {
+    return false;
+  }
+  m_stride = 12;
+  if (line + 2 < lines.size() && lines[line] == "property uchar red")
+  {
+    if (lines[line + 1] != "property uchar green" || lines[line + 2] != "property uchar blue")
+    {
+      return false;
+    }
+    m_hasColors = true;
+    m_colorOffset = m_stride;
+    m_stride += 3;
+    line += 3;
+  }
+  if (line < lines.size() && lines[line] == "property float intensity")
+  {
+    m_hasIntensities = true;
+    m_intensityOffset = m_stride;
+    m_stride += 4;
+    ++line;
+  }
+  if (line != lines.size())
+  {
+    return false;
+  }
+
+  // The vertices of a binary file have to be complete, ascii files are checked while parsing
+  const size_t dataSize = m_file.getSize() - m_vertexOffset;
+  if (m_isBinary && pointCount > dataSize / m_stride)
+  {
+    return false;
+  }
+  if (pointCount > dataSize)
+  {
+    return false;
+  }
+  m_pointCount = static_cast<size_t>(pointCount);
+  return true;
+}
+
+PlyVertexView PointCloudPlyReader::getVertices() const
+{
+  if (!m_isBinary)
+  {
+    return PlyVertexView(NULL, 0, 0, 0, 0);
+  }
+  return PlyVertexView(m_file.getData() + m_vertexOffset, m_pointCount, m_stride, m_colorOffset, m_intensityOffset);
+}
+
+template <typename Sink>
+bool PointCloudPlyReader::readVertices(Sink& sink) const
+{
+  if (!m_file.isOpen())
+  {
+    return false;
+  }
+  if (!m_isBinary)
+  {
+    return readAsciiVertices(sink);
+  }
+
+  const PlyVertexView vertices = getVertices();
+  const bool hasColors = m_hasColors;
+  const bool hasIntensities = m_hasIntensities;
+  const size_t colorOffset = m_colorOffset;
+  parallelFor(vertices.size(), m_numThreads, [=, &sink](size_t begin, size_t end)
+  {
+    PlyVertex vertex = PlyVertex();
+    for (size_t i = begin; i < end; ++i)
+    {
+      const PointXYZ point = vertices.getPoint(i);
+      vertex.x = point.x;
+      vertex.y = point.y;
+      vertex.z = point.z;
+      if (hasColors)
+      {
+        const uint8_t* pColor = vertices.getData() + i * vertices.getStride() + colorOffset;
+        vertex.red = pColor[0];
+        vertex.green = pColor[1];
+        vertex.blue = pColor[2];
+      }
+      if (hasIntensities)
+      {
+        vertex.intensity = vertices.getIntensity(i);
+      }
+      sink.set(i, vertex);
+    }
+  });
+  return true;
+}
+
+template <typename Sink>
+bool PointCloudPlyReader::readAsciiVertices(Sink& sink) const
+{
+  const char* pBegin = reinterpret_cast<const char*>(m_file.getData()) + m_vertexOffset;
+  const char* pEnd = reinterpret_cast<const char*>(m_file.getData()) + m_file.getSize();
+
+  // Chunks of whole lines, one per thread
+  size_t numChunks = (m_numThreads == 0) ? std::thread::hardware_concurrency() : m_numThreads;
+  numChunks = std::max(std::min(numChunks, static_cast<size_t>(pEnd - pBegin) / plyMinAsciiChunkSize), size_t(1));
+  std::vector<const char*> chunkStarts(numChunks + 1);
+  chunkStarts[0] = pBegin;
+  chunkStarts[numChunks] = pEnd;
+  for (size_t chunk = 1; chunk < numChunks; ++chunk)
+  {
+    const char* pStart = std::max(pBegin + (pEnd - pBegin) / static_cast<ptrdiff_t>(numChunks) * static_cast<ptrdiff_t>(chunk),
+                                  chunkStarts[chunk - 1]);
+    const char* pLineEnd = static_cast<const char*>(std::memchr(pStart, '\n', static_cast<size_t>(pEnd - pStart)));
+    chunkStarts[chunk] = (pLineEnd != NULL) ? pLineEnd + 1 : pEnd;
+  }
+
+  // First pass counts the lines of each chunk to know the index of its first vertex
+  std::vector<size_t> firstIndices(numChunks + 1, 0);
+  const char* const* pChunkStarts = chunkStarts.data();
+  size_t* pFirstIndices = firstIndices.data();
+  parallelFor(numChunks, m_numThreads, [=](size_t chunkBegin, size_t chunkEnd)
+  {
+    for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk)
+    {
+      const char* pStart = pChunkStarts[chunk];
+      const char* pStop = pChunkStarts[chunk + 1];
+      size_t lines = static_cast<size_t>(std::count(pStart, pStop, '\n'));
+      if (pStop != pStart && pStop[-1] != '\n')
+      {
+        // Last line without line end
+        ++lines;
+      }
+      pFirstIndices[chunk + 1] = lines;
+    }
+  });
+  for (size_t chunk = 0; chunk < numChunks; ++chunk)
+  {
+    firstIndices[chunk + 1] += firstIndices[chunk];
+  }
+  if (firstIndices[numChunks] < m_pointCount)
+  {
+    return false;
+  }
+
+  // Second pass parses the lines, lines after the last vertex are ignored
+  const size_t pointCount = m_pointCount;
+  const bool hasColors = m_hasColors;
+  const bool hasIntensities = m_hasIntensities;
+  std::vector<uint8_t> chunkOk(numChunks, 0);
+  uint8_t* pChunkOk = chunkOk.data();
+  parallelFor(numChunks, m_numThreads, [=, &sink](size_t chunkBegin, size_t chunkEnd)
+  {
+    PlyVertex vertex = PlyVertex();
+    for (size_t chunk = chunkBegin; chunk < chunkEnd; ++chunk)
+    {
+      const char* pLine = pChunkStarts[chunk];
+      const char* pStop = pChunkStarts[chunk + 1];
+      bool ok = true;
+      for (size_t index = pFirstIndices[chunk]; index < pointCount && pLine != pStop; ++index)
+      {
+        const char* pLineEnd = static_cast<const char*>(std::memchr(pLine, '\n', static_cast<size_t>(pStop - pLine)));
+        if (pLineEnd == NULL)
+        {
+          pLineEnd = pStop;
+        }
+        if (!parseVertexLine(pLine, pLineEnd, hasColors, hasIntensities, vertex))
+        {
+          ok = false;
+          break;
+        }
+        sink.set(index, vertex);
+        pLine = (pLineEnd != pStop) ? pLineEnd + 1 : pStop;
+      }
+      pChunkOk[chunk] = ok ? 1u : 0u;
+    }
+  });
+  return std::find(chunkOk.begin(), chunkOk.end(), uint8_t(0)) == chunkOk.end();
+}
+
+bool PointCloudPlyReader::readPoints(std::vector<PointXYZ>& points) const
+{
+  points.resize(m_pointCount);
+  PointMapSink sink = { points.data(), NULL, NULL };
+  return readVertices(sink);
+}
+
+bool PointCloudPlyReader::readPoints(std::vector<PointXYZ>& points, std::vector<uint32_t>& rgbaMap,
+                                     std::vector<uint16_t>& intensityMap) const
+{
+  points.resize(m_pointCount);
+  rgbaMap.resize(m_hasColors ? m_pointCount : 0);
+  intensityMap.resize(m_hasIntensities ? m_pointCount : 0);
+  PointMapSink sink = { points.data(), m_hasColors ? rgbaMap.data() : NULL, m_hasIntensities ? intensityMap.data() : NULL };
+  return readVertices(sink);
+}
+
+bool PointCloudPlyReader::readPoints(std::vector<PointXYZRGB>& points) const
+{
+  points.resize(m_pointCount);
+  RgbPointSink sink = { points.data() };
+  return readVertices(sink);
+}
+
+bool PointCloudPlyReader::readPoints(std::vector<PointXYZI>& points) const
+{
+  points.resize(m_pointCount);
+  IntensityPointSink sink = { points.data() };
+  return readVertices(sink);
+}
+
+}
@@ -0,0 +1,164 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MappedFile.h"
+#include "PointXYZ.h"
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// View of the vertices of a binary PLY file in place, without copying them.
+/// The view is valid as long as the PointCloudPlyReader it comes from keeps the file open.
+/// </summary>
+class PlyVertexView
+{
+public:
+  PlyVertexView(const uint8_t* pData, size_t count, size_t stride, size_t colorOffset, size_t intensityOffset)
+    : m_pData(pData)
+    , m_count(count)
+    , m_stride(stride)
+    , m_colorOffset(colorOffset)
+    , m_intensityOffset(intensityOffset)
+  {
+  }
+
+  size_t size() const
+  {
+    return m_count;
+  }
+
+  /// <summary>Start of the vertex data, the vertices follow each other with getStride() bytes.</summary>
+  const uint8_t* getData() const
+  {
+    return m_pData;
+  }
+
+  size_t getStride() const
+  {
+    return m_stride;
+  }
+
+  PointXYZ getPoint(size_t index) const
+  {
+    const uint8_t* pVertex = m_pData + index * m_stride;
+    PointXYZ point;
+    point.x = readUnalignLittleEndian<float>(pVertex);
+    point.y = readUnalignLittleEndian<float>(pVertex + 4);
+    point.z = readUnalignLittleEndian<float>(pVertex + 8);
+    return point;
+  }
+
+  /// <summary>Color of a vertex as RGBA map pixel, alpha is 255. Only valid if the file has colors.</summary>
+  uint32_t getRGBA(size_t index) const
+  {
+    const uint8_t* pColor = m_pData + index * m_stride + m_colorOffset;
+    const uint8_t rgba[4] = { pColor[0], pColor[1], pColor[2], 255u };
+    return readUnaligned<uint32_t>(rgba);
+  }
+
+  /// <summary>Intensity of a vertex as written to the file (0 to 1). Only valid if the file has intensities.</summary>
+  float getIntensity(size_t index) const
+  {
+    return readUnalignLittleEndian<float>(m_pData + index * m_stride + m_intensityOffset);
+  }
+
+private:
+  const uint8_t* m_pData;
+  size_t m_count;
+  size_t m_stride;
+  size_t m_colorOffset;
+  size_t m_intensityOffset;
+};
+
+/// <summary>
+/// Class for reading point clouds from PLY files in the formats PointCloudPlyWriter writes:
+/// ascii or binary little endian, x, y and z with optional colors and intensity.
+/// The file is memory mapped; binary vertices can be accessed in place with getVertices(), ascii files are
+/// parsed in parallel.
+/// </summary>
+class PointCloudPlyReader
+{
+public:
+  PointCloudPlyReader();
+  ~PointCloudPlyReader();
+
+  /// <summary>Set the number of threads the vertices are split on, 0 uses one thread per hardware thread.
+  /// The default is 0.</summary>
+  void setNumThreads(unsigned numThreads);
+
+  /// <summary>Map a PLY file and read its header.</summary>
+  /// <param name="filename">The file to read</param>
+  /// <returns>Returns false if the file cannot be mapped or is not in a format written by PointCloudPlyWriter</returns>
+  bool open(const char* filename);
+
+  /// <summary>Unmap the file, views returned by getVertices get invalid.</summary>
+  void close();
+
+  size_t getPointCount() const;
+  bool isBinary() const;
+  bool hasColors() const;
+  bool hasIntensities() const;
+
+  /// <summary>Vertices of a binary file in place. The view is empty for ascii files.</summary>
+  PlyVertexView getVertices() const;
+
+  /// <summary>Read the points.</summary>
+  /// <param name="points">The points of the file</param>
+  /// <returns>Returns false if the vertex data is damaged</returns>
+  bool readPoints(std::vector<PointXYZ>& points) const;
+
+  /// <summary>Read the points with the maps PointCloudPlyWriter::WriteFormatPLY takes.</summary>
+  /// <param name="points">The points of the file</param>
+  /// <param name="rgbaMap">RGBA colors of the points with alpha 255, empty if the file has no colors</param>
+  /// <param name="intensityMap">Intensities of the points, scaled back to 0 to 65535, empty if the file has no intensities</param>
+  /// <returns>Returns false if the vertex data is damaged</returns>
+  bool readPoints(std::vector<PointXYZ>& points, std::vector<uint32_t>& rgbaMap, std::vector<uint16_t>& intensityMap) const;
+
+  /// <summary>Same as above for a point cloud with colors, black if the file has no colors.</summary>
+  bool readPoints(std::vector<PointXYZRGB>& points) const;
+
+  /// <summary>Same as above for a point cloud with intensities scaled back to 0 to 65535, 0 if the file has no intensities.</summary>
+  bool readPoints(std::vector<PointXYZI>& points) const;
+
+private:
+  // No copies, the mapping is owned
+  PointCloudPlyReader(const PointCloudPlyReader&);
+  const PointCloudPlyReader& operator=(const PointCloudPlyReader&);
+
+  bool parseHeader();
+
+  template <typename Sink>
+  bool readVertices(Sink& sink) const;
+
+  template <typename Sink>
+  bool readAsciiVertices(Sink& sink) const;
+
+  MappedFile m_file;
+  unsigned m_numThreads;
+
+  // Header information
+  size_t m_pointCount;
+  bool m_isBinary;
+  bool m_hasColors;
+  bool m_hasIntensities;
+  // Offset of the first vertex in the file
+  size_t m_vertexOffset;
+  size_t m_stride;
+  size_t m_colorOffset;
+  size_t m_intensityOffset;
+};
+
+}
@@ -8,118 +8,465 @@
 
 #include "PointCloudPlyWriter.h"
 
+#include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include "ParallelFor.h"
 #include "VisionaryEndian.h"
 
 namespace visionary 
 {
 
-bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, bool useBinary)
+// Number of points gathered into the local arrays of a VertexBlock
+static const size_t plyBlockSize = 256;
+// Number of points formatted before they are written to the file, bounds the memory used by the buffers
+static const size_t plyBatchSize = 65536;
+// Number of points of an ascii piece, the pieces of a batch are formatted in parallel
+static const size_t plyAsciiPieceSize = 4096;
+// Longest ascii vertex: four floats, three colors, separators and the line end
+static const size_t plyAsciiMaxVertexChars = 4 * 16 + 3 * 4 + 1;
+
+// Vertex attributes of a block of points as separate arrays, filled by the point sources below
+struct VertexBlock
 {
-  return WriteFormatPLY(filename, points, std::vector<uint32_t>(), std::vector<uint16_t>(), useBinary);
-}
+  float x[plyBlockSize];
+  float y[plyBlockSize];
+  float z[plyBlockSize];
+  uint8_t red[plyBlockSize];
+  uint8_t green[plyBlockSize];
+  uint8_t blue[plyBlockSize];
+  float intensity[plyBlockSize];
+};
 
-bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint32_t>& rgbaMap, bool useBinary)
+// Points with optional color and intensity maps
+class MapPointSource
 {
-  return WriteFormatPLY(filename, points, rgbaMap, std::vector<uint16_t>(), useBinary);
-}
+public:
+  MapPointSource(const std::vector<PointXYZ>& points, const uint32_t* pRgba, const uint16_t* pIntensity)
+    : m_pPoints(points.data())
+    , m_pRgba(reinterpret_cast<const uint8_t*>(pRgba))
+    , m_pIntensity(pIntensity)
+  {
+  }
 
-bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint16_t>& intensityMap, bool useBinary)
+  void fill(size_t first, size_t count, VertexBlock& block) const
+  {
+    const PointXYZ* pPoints = m_pPoints + first;
+    for (size_t i = 0; i < count; ++i)
+    {
+      block.x[i] = pPoints[i].x;
+      block.y[i] = pPoints[i].y;
+      block.z[i] = pPoints[i].z;
+    }
+    if (m_pRgba != NULL)
+    {
+      // Bytes in memory order of the RGBA pixel
+      const uint8_t* pRgba = m_pRgba + 4 * first;
+      for (size_t i = 0; i < count; ++i)
+      {
+        block.red[i] = pRgba[4 * i];
+        block.green[i] = pRgba[4 * i + 1];
+        block.blue[i] = pRgba[4 * i + 2];
+      }
+    }
+    if (m_pIntensity != NULL)
+    {
+      const uint16_t* pIntensity = m_pIntensity + first;
+      for (size_t i = 0; i < count; ++i)
+      {
+        block.intensity[i] = static_cast<float>(pIntensity[i]) / 65535.0f;
+      }
+    }
+  }
+
+private:
+  const PointXYZ* m_pPoints;
+  const uint8_t* m_pRgba;
+  const uint16_t* m_pIntensity;
+};
+
+class RgbPointSource
 {
-  return WriteFormatPLY(filename, points, std::vector<uint32_t>(), intensityMap, useBinary);
-}
+public:
+  explicit RgbPointSource(const std::vector<PointXYZRGB>& points)
+    : m_pPoints(points.data())
+  {
+  }
 
-bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint32_t>& rgbaMap, const std::vector<uint16_t>& intensityMap, bool useBinary)
+  void fill(size_t first, size_t count, VertexBlock& block) const
+  {
+    const PointXYZRGB* pPoints = m_pPoints + first;
+    for (size_t i = 0; i < count; ++i)
+    {
+      block.x[i] = pPoints[i].x;
+      block.y[i] = pPoints[i].y;
+      block.z[i] = pPoints[i].z;
+      block.red[i] = pPoints[i].r;
+      block.green[i] = pPoints[i].g;
+      block.blue[i] = pPoints[i].b;
+    }
+  }
+
+private:
+  const PointXYZRGB* m_pPoints;
+};
+
+class IntensityPointSource
 {
-  bool success = true;
+public:
+  explicit IntensityPointSource(const std::vector<PointXYZI>& points)
+    : m_pPoints(points.data())
+  {
+  }
 
-  bool hasColors = points.size() == rgbaMap.size();
-  bool hasIntensities = points.size() == intensityMap.size();
+  void fill(size_t first, size_t count, VertexBlock& block) const
+  {
+    const PointXYZI* pPoints = m_pPoints + first;
+    for (size_t i = 0; i < count; ++i)
+    {
+      block.x[i] = pPoints[i].x;
+      block.y[i] = pPoints[i].y;
+      block.z[i] = pPoints[i].z;
+      block.intensity[i] = pPoints[i].intensity / 65535.0f;
+    }
+  }
 
-  std::ofstream stream;
+private:
+  const PointXYZI* m_pPoints;
+};
 
-  // Open file
-  stream.open(filename, useBinary ? (std::ios_base::out | std::ios_base::binary) : std::ios_base::out);
+//-----------------------------------------------
+// Binary vertices
 
-  if (stream.is_open())
+template <bool HasColors, bool HasIntensities>
+static char* packBinary(const VertexBlock& block, size_t count, char* pOut)
+{
+  for (size_t i = 0; i < count; ++i)
   {
-    // Write header
-    stream << "ply\n";
-    stream << "format " << (useBinary ? "binary_little_endian" : "ascii") << " 1.0\n";
-    stream << "element vertex " << points.size() << "\n";
-    stream << "property float x\n";
-    stream << "property float y\n";
-    stream << "property float z\n";
-    if (hasColors)
+    writeUnalignLittleEndian<float>(pOut, block.x[i]);
+    writeUnalignLittleEndian<float>(pOut + 4, block.y[i]);
+    writeUnalignLittleEndian<float>(pOut + 8, block.z[i]);
+    pOut += 12;
+    if (HasColors)
     {
-      stream << "property uchar red\n";
-      stream << "property uchar green\n";
-      stream << "property uchar blue\n";
+      pOut[0] = static_cast<char>(block.red[i]);
+      pOut[1] = static_cast<char>(block.green[i]);
+      pOut[2] = static_cast<char>(block.blue[i]);
+      pOut += 3;
     }
-    if (hasIntensities)
+    if (HasIntensities)
+    {
+      writeUnalignLittleEndian<float>(pOut, block.intensity[i]);
+      pOut += 4;
+    }
+  }
+  return pOut;
+}
+
+template <typename Source>
+static bool writeBinaryVertices(std::ostream& stream, const Source& source, size_t numPoints, bool hasColors, bool hasIntensities)
+{
+  const size_t vertexSize = 12 + (hasColors ? 3 : 0) + (hasIntensities ? 4 : 0);
+  std::vector<char> buffer(vertexSize * ((numPoints < plyBatchSize) ? numPoints : plyBatchSize));
+  VertexBlock block;
+
+  for (size_t batchBegin = 0; batchBegin < numPoints; batchBegin += plyBatchSize)
+  {
+    const size_t batchEnd = (numPoints - batchBegin < plyBatchSize) ? numPoints : batchBegin + plyBatchSize;
+    char* pOut = buffer.data();
+    for (size_t first = batchBegin; first < batchEnd; first += plyBlockSize)
     {
-      stream << "property float intensity\n";
+      const size_t count = (batchEnd - first < plyBlockSize) ? batchEnd - first : plyBlockSize;
+      source.fill(first, count, block);
+      if (hasColors)
+      {
+        pOut = hasIntensities ? packBinary<true, true>(block, count, pOut) : packBinary<true, false>(block, count, pOut);
+      }
+      else
+      {
+        pOut = hasIntensities ? packBinary<false, true>(block, count, pOut) : packBinary<false, false>(block, count, pOut);
+      }
     }
-    stream << "end_header\n";
+    stream.write(buffer.data(), pOut - buffer.data());
+  }
+  return stream.good();
+}
 
-    if (useBinary == false)
+//-----------------------------------------------
+// Ascii vertices
+
+static char* formatUnsigned(char* pOut, uint32_t value)
+{
+  char digits[10];
+  int numDigits = 0;
+  do
+  {
+    digits[numDigits++] = static_cast<char>('0' + value % 10u);
+    value /= 10u;
+  } while (value != 0);
+  while (numDigits > 0)
+  {
+    *pOut++ = digits[--numDigits];
+  }
+  return pOut;
+}
+
+// Formats a float like printf("%g") (and std::ostream with the default precision) does:
+// six significant digits, no trailing zeros. Values with an exponent outside [-4, 5], infinity and NaN are rare
+// in point clouds and left to snprintf.
+static char* formatFloat(char* pOut, float value)
+{
+  static const double powers[] = { 1e-4, 1e-3, 1e-2, 1e-1, 1e0, 1e1, 1e2, 1e3, 1e4, 1e5 };
+  static const double scales[] = { 1e9, 1e8, 1e7, 1e6, 1e5, 1e4, 1e3, 1e2, 1e1, 1e0 };
+
+  double magnitude = std::fabs(static_cast<double>(value));
+  if (magnitude >= 1e-4 && magnitude < 1e6)
+  {
+    int index = 9;
+    while (magnitude < powers[index])
     {
-      // Write all points
-      for (int i = 0; i < static_cast<int>(points.size()); i++)
+      --index;
+    }
+    // The product is exact, floats have 24 bit mantissas and the scales are at most 30 bit integers
+    double scaled = magnitude * scales[index];
+    uint32_t significand = static_cast<uint32_t>(scaled);
+    const double fraction = scaled - significand;
+    if (fraction > 0.5 || (fraction == 0.5 && (significand & 1u)))
+    {
+      ++significand;
+    }
+    if (significand >= 1000000u)
+    {
+      // Rounded up to the next power of ten
+      significand /= 10u;
+      ++index;
+    }
+    if (index <= 9)
+    {
+      char digits[6];
+      for (int i = 5; i >= 0; --i)
+      {
+        digits[i] = static_cast<char>('0' + significand % 10u);
+        significand /= 10u;
+      }
+      int numDigits = 6;
+      while (digits[numDigits - 1] == '0')
       {
-        PointXYZ point = points.at(i);
-        stream << point.x << " " << point.y << " " << point.z;
+        --numDigits;
+      }
 
-        if (hasColors)
+      if (std::signbit(value))
+      {
+        *pOut++ = '-';
+      }
+      const int exponent = index - 4;
+      if (exponent >= 0)
+      {
+        int i = 0;
+        for (; i <= exponent; ++i)
         {
-          const uint8_t *rgba = reinterpret_cast<const uint8_t*>(&rgbaMap.at(i));
-          stream << " " << static_cast<uint32_t>(rgba[0]) << " " << static_cast<uint32_t>(rgba[1]) << " " << static_cast<uint32_t>(rgba[2]);
+          *pOut++ = (i < numDigits) ? digits[i] : '0';
         }
-        if (hasIntensities)
+        if (i < numDigits)
         {
-          float intensity = static_cast<float>(intensityMap.at(i)) / 65535.0f;
-          stream << " " << intensity;
+          *pOut++ = '.';
+          for (; i < numDigits; ++i)
+          {
+            *pOut++ = digits[i];
+          }
+        }
+      }
+      else
+      {
+        *pOut++ = '0';
+        *pOut++ = '.';
+        for (int i = -1; i > exponent; --i)
+        {
+          *pOut++ = '0';
+        }
+        for (int i = 0; i < numDigits; ++i)
+        {
+          *pOut++ = digits[i];
         }
-
-        stream << "\n";
       }
+      return pOut;
     }
-    else
+  }
+  else if (value == 0.0f)
+  {
+    if (std::signbit(value))
     {
-      // Write all points
-      for (int i = 0; i < static_cast<int>(points.size()); i++)
-      {
-        PointXYZ point = points.at(i);
-        float x = nativeToLittleEndian(point.x);
-        float y = nativeToLittleEndian(point.y);
-        float z = nativeToLittleEndian(point.z);
+      *pOut++ = '-';
+    }
+    *pOut++ = '0';
+    return pOut;
+  }
 
-        stream.write(reinterpret_cast<char*>(&x), 4);
-        stream.write(reinterpret_cast<char*>(&y), 4);
-        stream.write(reinterpret_cast<char*>(&z), 4);
+  char text[16];
+  const int length = std::snprintf(text, sizeof(text), "%g", static_cast<double>(value));
+  std::memcpy(pOut, text, static_cast<size_t>(length));
+  return pOut + length;
+}
 
-        if (hasColors)
-        {
-          stream.write(reinterpret_cast<const char*>(&rgbaMap.at(i)), 3);
-        }
-        if (hasIntensities)
+static char* formatAscii(const VertexBlock& block, size_t count, bool hasColors, bool hasIntensities, char* pOut)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    pOut = formatFloat(pOut, block.x[i]);
+    *pOut++ = ' ';
+    pOut = formatFloat(pOut, block.y[i]);
+    *pOut++ = ' ';
+    pOut = formatFloat(pOut, block.z[i]);
+    if (hasColors)
+    {
+      *pOut++ = ' ';
+      pOut = formatUnsigned(pOut, block.red[i]);
+      *pOut++ = ' ';
+      pOut = formatUnsigned(pOut, block.green[i]);
+      *pOut++ = ' ';
+      pOut = formatUnsigned(pOut, block.blue[i]);
+    }
+    if (hasIntensities)
+    {
+      *pOut++ = ' ';
+      pOut = formatFloat(pOut, block.intensity[i]);
+    }
+    *pOut++ = '\n';
+  }
+  return pOut;
+}
+
+template <typename Source>
+static bool writeAsciiVertices(std::ostream& stream, const Source& source, size_t numPoints, bool hasColors, bool hasIntensities)
+{
+  const size_t piecesPerBatch = plyBatchSize / plyAsciiPieceSize;
+  std::vector<std::vector<char> > pieces(piecesPerBatch);
+  std::vector<size_t> pieceLengths(piecesPerBatch);
+
+  for (size_t batchBegin = 0; batchBegin < numPoints; batchBegin += plyBatchSize)
+  {
+    const size_t batchEnd = (numPoints - batchBegin < plyBatchSize) ? numPoints : batchBegin + plyBatchSize;
+    const size_t numPieces = (batchEnd - batchBegin + plyAsciiPieceSize - 1) / plyAsciiPieceSize;
+    std::vector<char>* pPieces = pieces.data();
+    size_t* pLengths = pieceLengths.data();
+    const Source* pSource = &source;
+    parallelFor(numPieces, 0u, [=](size_t pieceBegin, size_t pieceEnd)
+    {
+      VertexBlock block;
+      for (size_t piece = pieceBegin; piece < pieceEnd; ++piece)
+      {
+        const size_t pieceFirst = batchBegin + piece * plyAsciiPieceSize;
+        const size_t pieceLast = (batchEnd - pieceFirst < plyAsciiPieceSize) ? batchEnd : pieceFirst + plyAsciiPieceSize;
+        std::vector<char>& text = pPieces[piece];
+        text.resize(plyAsciiMaxVertexChars * plyAsciiPieceSize);
+        char* pOut = text.data();
+        for (size_t first = pieceFirst; first < pieceLast; first += plyBlockSize)
         {
-          float intensity = static_cast<float>(intensityMap.at(i)) / 65535.0f;
-          stream.write(reinterpret_cast<const char*>(&intensity), 4);
+          const size_t count = (pieceLast - first < plyBlockSize) ? pieceLast - first : plyBlockSize;
+          pSource->fill(first, count, block);
+          pOut = formatAscii(block, count, hasColors, hasIntensities, pOut);
         }
+        pLengths[piece] = static_cast<size_t>(pOut - text.data());
       }
+    });
+
+    for (size_t piece = 0; piece < numPieces; ++piece)
+    {
+      stream.write(pieces[piece].data(), pieceLengths[piece]);
     }
   }
+  return stream.good();
+}
+
+//-----------------------------------------------
+
+template <typename Source>
+static bool writePly(const char* filename, const Source& source, size_t numPoints, bool hasColors, bool hasIntensities, bool useBinary)
+{
+  std::ofstream stream;
+
+  // Open file
+  stream.open(filename, useBinary ? (std::ios_base::out | std::ios_base::binary) : std::ios_base::out);
+
+  if (!stream.is_open())
+  {
+    return false;
+  }
+
+  // Write header
+  std::ostringstream header;
+  header << "ply\n";
+  header << "format " << (useBinary ? "binary_little_endian" : "ascii") << " 1.0\n";
+  header << "element vertex " << numPoints << "\n";
+  header << "property float x\n";
+  header << "property float y\n";
+  header << "property float z\n";
+  if (hasColors)
+  {
+    header << "property uchar red\n";
+    header << "property uchar green\n";
+    header << "property uchar blue\n";
+  }
+  if (hasIntensities)
+  {
+    header << "property float intensity\n";
+  }
+  header << "end_header\n";
+  const std::string headerText = header.str();
+  stream.write(headerText.data(), headerText.size());
+
+  // Write all points
+  bool success;
+  if (useBinary)
+  {
+    success = writeBinaryVertices(stream, source, numPoints, hasColors, hasIntensities);
+  }
   else
   {
-    success = false;
+    success = writeAsciiVertices(stream, source, numPoints, hasColors, hasIntensities);
   }
 
   // Close file
   stream.close();
 
-  return success;
+  return success && !stream.fail();
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, bool useBinary)
+{
+  return WriteFormatPLY(filename, points, std::vector<uint32_t>(), std::vector<uint16_t>(), useBinary);
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint32_t>& rgbaMap, bool useBinary)
+{
+  return WriteFormatPLY(filename, points, rgbaMap, std::vector<uint16_t>(), useBinary);
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint16_t>& intensityMap, bool useBinary)
+{
+  return WriteFormatPLY(filename, points, std::vector<uint32_t>(), intensityMap, useBinary);
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint32_t>& rgbaMap, const std::vector<uint16_t>& intensityMap, bool useBinary)
+{
+  const bool hasColors = points.size() == rgbaMap.size();
+  const bool hasIntensities = points.size() == intensityMap.size();
+
+  const MapPointSource source(points, hasColors ? rgbaMap.data() : NULL, hasIntensities ? intensityMap.data() : NULL);
+  return writePly(filename, source, points.size(), hasColors, hasIntensities, useBinary);
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZRGB>& points, bool useBinary)
+{
+  return writePly(filename, RgbPointSource(points), points.size(), true, false, useBinary);
+}
+
+bool PointCloudPlyWriter::WriteFormatPLY(const char* filename, const std::vector<PointXYZI>& points, bool useBinary)
+{
+  return writePly(filename, IntensityPointSource(points), points.size(), false, true, useBinary);
 }
 
 PointCloudPlyWriter::PointCloudPlyWriter()
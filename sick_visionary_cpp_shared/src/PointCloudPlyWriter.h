@@ -17,7 +17,8 @@
 namespace visionary 
 {
 
-/// <summary>Class for writing point clouds to PLY files.</summary>
+/// <summary>Class for writing point clouds to PLY files.
+/// The vertices are formatted in large blocks which are written with few calls, ascii text is formatted in parallel.</summary>
 class PointCloudPlyWriter
 {
 public:
@@ -54,6 +55,20 @@ public:
   /// <returns>Returns true if write was successful and false otherwise</returns>
   static bool WriteFormatPLY(const char* filename, const std::vector<PointXYZ>& points, const std::vector<uint32_t>& rgbaMap, const std::vector<uint16_t>& intensityMap, bool useBinary);
 
+  /// <summary>Save a point cloud with colors, e.g. from VisionaryData::generatePointCloud, to a file in Polygon File Format (PLY), see: https://en.wikipedia.org/wiki/PLY_%28file_format%29 </summary>
+  /// <param name="filename">The file to save the point cloud to</param>
+  /// <param name="points">The points to save</param>
+  /// <param name="useBinary">If the output file is binary or ascii</param>
+  /// <returns>Returns true if write was successful and false otherwise</returns>
+  static bool WriteFormatPLY(const char* filename, const std::vector<PointXYZRGB>& points, bool useBinary);
+
+  /// <summary>Save a point cloud with intensities, e.g. from VisionaryData::generatePointCloud, to a file in Polygon File Format (PLY), see: https://en.wikipedia.org/wiki/PLY_%28file_format%29 </summary>
+  /// <param name="filename">The file to save the point cloud to</param>
+  /// <param name="points">The points to save, the intensities are scaled by 1/65535 like the intensity map overloads do</param>
+  /// <param name="useBinary">If the output file is binary or ascii</param>
+  /// <returns>Returns true if write was successful and false otherwise</returns>
+  static bool WriteFormatPLY(const char* filename, const std::vector<PointXYZI>& points, bool useBinary);
+
 private:
 
   // No instantiations
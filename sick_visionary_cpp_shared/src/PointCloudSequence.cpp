@@ -0,0 +1,516 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "PointCloudSequence.h"
+
+#include <algorithm>
+
+#include "VisionaryEndian.h"
+
+namespace visionary
+{
+
+static const uint32_t sequenceMagic = 0x31535056u;   // "VPS1" in little endian
+static const uint32_t sequenceVersion = 1u;
+static const uint32_t frameMagic = 0x314D5246u;      // "FRM1"
+static const uint32_t indexMagic = 0x31584449u;      // "IDX1"
+static const uint32_t trailerMagic = 0x45535056u;    // "VPSE"
+
+static const size_t sequenceHeaderSize = 8;
+static const size_t frameHeaderSize = 36;
+static const size_t indexHeaderSize = 12;
+static const size_t indexEntrySize = 24;
+static const size_t trailerSize = 12;
+
+// Flags of a frame chunk
+static const uint32_t frameCompressed = 1u;
+
+// Bit n of the plane mask of a frame chunk tells if the n-th of these planes is stored, in this order:
+// X, Y, Z (float), intensity, confidence (16 bit)
+static const uint32_t numPlanes = 5;
+
+template <typename T>
+static void appendValue(std::vector<uint8_t>& buffer, T value)
+{
+  const size_t offset = buffer.size();
+  buffer.resize(offset + sizeof(T));
+  writeUnalignLittleEndian<T>(buffer.data() + offset, value);
+}
+
+template <typename T>
+static void appendPlane(std::vector<uint8_t>& buffer, const std::vector<T>& plane)
+{
+  appendValue<uint32_t>(buffer, static_cast<uint32_t>(plane.size() * sizeof(T)));
+  const size_t offset = buffer.size();
+  buffer.resize(offset + plane.size() * sizeof(T));
+  writeLittleEndianArray<T>(buffer.data() + offset, plane.data(), plane.size());
+}
+
+static void appendEncodedPlane(std::vector<uint8_t>& buffer, const std::vector<uint8_t>& encoded)
+{
+  appendValue<uint32_t>(buffer, static_cast<uint32_t>(encoded.size()));
+  buffer.insert(buffer.end(), encoded.begin(), encoded.end());
+}
+
+static size_t paddedSize(size_t size)
+{
+  return (size + 3u) & ~size_t(3u);
+}
+
+template <typename T>
+static void readPlane(const uint8_t* pData, size_t count, std::vector<T>& plane)
+{
+  plane.resize(count);
+  readLittleEndianArray<T>(pData, plane.data(), count);
+}
+
+//-----------------------------------------------
+
+void PointCloudFrame::setPoints(const std::vector<PointXYZ>& points)
+{
+  x.resize(points.size());
+  y.resize(points.size());
+  z.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i)
+  {
+    x[i] = points[i].x;
+    y[i] = points[i].y;
+    z[i] = points[i].z;
+  }
+}
+
+void PointCloudFrame::getPoints(std::vector<PointXYZ>& points) const
+{
+  const size_t count = std::min(x.size(), std::min(y.size(), z.size()));
+  points.resize(count);
+  for (size_t i = 0; i < count; ++i)
+  {
+    points[i].x = x[i];
+    points[i].y = y[i];
+    points[i].z = z[i];
+  }
+}
+
+//-----------------------------------------------
+
+PointCloudSequenceWriter::PointCloudSequenceWriter()
+  : m_offset(0)
+  , m_compress(true)
+{
+}
+
+PointCloudSequenceWriter::~PointCloudSequenceWriter()
+{
+  close();
+}
+
+void PointCloudSequenceWriter::setCompression(bool compress)
+{
+  m_compress = compress;
+}
+
+size_t PointCloudSequenceWriter::getFrameCount() const
+{
+  return m_index.size();
+}
+
+bool PointCloudSequenceWriter::open(const char* filename, bool append)
+{
+  close();
+  m_index.clear();
+
+  if (append)
+  {
+    PointCloudSequenceReader reader;
+    if (reader.open(filename))
+    {
+      // The new frames and index follow the old index, which is not referenced anymore
+      m_index = reader.m_index;
+      m_offset = reader.m_file.getSize();
+      reader.close();
+      m_file.open(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::app);
+      return m_file.is_open();
+    }
+    std::ifstream existing(filename, std::ios_base::binary | std::ios_base::ate);
+    if (existing.is_open() && existing.tellg() > 0)
+    {
+      // Not a sequence, do not overwrite
+      return false;
+    }
+  }
+
+  m_file.open(filename, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+  if (!m_file.is_open())
+  {
+    return false;
+  }
+  m_chunk.clear();
+  appendValue<uint32_t>(m_chunk, sequenceMagic);
+  appendValue<uint32_t>(m_chunk, sequenceVersion);
+  m_file.write(reinterpret_cast<const char*>(m_chunk.data()), static_cast<std::streamsize>(m_chunk.size()));
+  m_offset = m_chunk.size();
+  return m_file.good();
+}
+
+bool PointCloudSequenceWriter::close()
+{
+  if (!m_file.is_open())
+  {
+    return true;
+  }
+
+  m_chunk.clear();
+  appendValue<uint32_t>(m_chunk, indexMagic);
+  appendValue<uint64_t>(m_chunk, m_index.size());
+  for (std::vector<IndexEntry>::const_iterator it = m_index.begin(); it != m_index.end(); ++it)
+  {
+    appendValue<uint32_t>(m_chunk, it->frameNumber);
+    appendValue<uint32_t>(m_chunk, 0u);
+    appendValue<uint64_t>(m_chunk, it->timestampMS);
+    appendValue<uint64_t>(m_chunk, it->offset);
+  }
+  appendValue<uint64_t>(m_chunk, m_offset);
+  appendValue<uint32_t>(m_chunk, trailerMagic);
+  m_file.write(reinterpret_cast<const char*>(m_chunk.data()), static_cast<std::streamsize>(m_chunk.size()));
+  m_file.close();
+  const bool success = !m_file.fail();
+  m_file.clear();
+  return success;
+}
+
+bool PointCloudSequenceWriter::appendFrame(const PointCloudFrame& frame)
+{
+  const size_t count = static_cast<size_t>(frame.width) * frame.height;
+  const size_t planeSizes[] = { frame.x.size(), frame.y.size(), frame.z.size(), frame.intensity.size(), frame.confidence.size() };
+  uint32_t planeMask = 0;
+  for (size_t plane = 0; plane < sizeof(planeSizes) / sizeof(planeSizes[0]); ++plane)
+  {
+    if (planeSizes[plane] != 0)
+    {
+      if (planeSizes[plane] != count)
+      {
+        return false;
+      }
+      planeMask |= 1u << plane;
+    }
+  }
+  if (!m_file.is_open() || count > 0xFFFFFFFFu / 20u)
+  {
+    return false;
+  }
+
+  m_chunk.clear();
+  appendValue<uint32_t>(m_chunk, frameMagic);
+  // Chunk size, set below
+  appendValue<uint32_t>(m_chunk, 0u);
+  appendValue<uint32_t>(m_chunk, frame.frameNumber);
+  appendValue<uint32_t>(m_chunk, m_compress ? frameCompressed : 0u);
+  appendValue<uint64_t>(m_chunk, frame.timestampMS);
+  appendValue<uint32_t>(m_chunk, frame.width);
+  appendValue<uint32_t>(m_chunk, frame.height);
+  appendValue<uint32_t>(m_chunk, planeMask);
+
+  const std::vector<float>* floatPlanes[] = { &frame.x, &frame.y, &frame.z };
+  for (size_t plane = 0; plane < 3; ++plane)
+  {
+    if (!floatPlanes[plane]->empty())
+    {
+      appendPlane(m_chunk, *floatPlanes[plane]);
+    }
+  }
+  const std::vector<uint16_t>* mapPlanes[] = { &frame.intensity, &frame.confidence };
+  for (size_t plane = 0; plane < 2; ++plane)
+  {
+    if (mapPlanes[plane]->empty())
+    {
+      continue;
+    }
+    if (m_compress)
+    {
+      // frames above the size limit of the codec are not written
+      if (!m_codec.encode(*mapPlanes[plane], static_cast<int>(frame.width), static_cast<int>(frame.height), m_encoded))
+      {
+        return false;
+      }
+      appendEncodedPlane(m_chunk, m_encoded);
+    }
+    else
+    {
+      appendPlane(m_chunk, *mapPlanes[plane]);
+    }
+    m_chunk.resize(paddedSize(m_chunk.size()), 0u);
+  }
+  // The chunk size is 32 bit, the limit on the point count above keeps even badly compressible frames below it
+  writeUnalignLittleEndian<uint32_t>(m_chunk.data() + 4, static_cast<uint32_t>(m_chunk.size()));
+
+  m_file.write(reinterpret_cast<const char*>(m_chunk.data()), static_cast<std::streamsize>(m_chunk.size()));
+  if (!m_file.good())
+  {
+    return false;
+  }
+  IndexEntry entry;
+  entry.frameNumber = frame.frameNumber;
+  entry.timestampMS = frame.timestampMS;
+  entry.offset = m_offset;
+  m_index.push_back(entry);
+  m_offset += m_chunk.size();
+  return true;
+}
+
+//-----------------------------------------------
+
+PointCloudSequenceReader::PointCloudSequenceReader()
+  : m_consecutiveNumbers(false)
+{
+}
+
+PointCloudSequenceReader::~PointCloudSequenceReader()
+{
+}
+
+bool PointCloudSequenceReader::open(const char* filename)
+{
+  close();
+  if (!m_file.open(filename) || !readIndex())
+  {
+    close();
+    return false;
+  }
+
+  m_consecutiveNumbers = true;
+  for (size_t i = 1; i < m_index.size() && m_consecutiveNumbers; ++i)
+  {
+    m_consecutiveNumbers = (m_index[i].frameNumber == static_cast<uint32_t>(m_index[0].frameNumber + i));
+  }
+  return true;
+}
+
+void PointCloudSequenceReader::close()
+{
+  m_file.close();
+  m_index.clear();
+  m_consecutiveNumbers = false;
+}
+
+bool PointCloudSequenceReader::readIndex()
+{
+  const uint8_t* pData = m_file.getData();
+  const size_t size = m_file.getSize();
+  if (size < sequenceHeaderSize || readUnalignLittleEndian<uint32_t>(pData) != sequenceMagic
+    || readUnalignLittleEndian<uint32_t>(pData + 4) != sequenceVersion)
+  {
+    return false;
+  }
+
+  if (size >= sequenceHeaderSize + indexHeaderSize + trailerSize
+    && readUnalignLittleEndian<uint32_t>(pData + size - 4) == trailerMagic)
+  {
+    const uint64_t indexOffset = readUnalignLittleEndian<uint64_t>(pData + size - trailerSize);
+    const uint64_t indexEnd = size - trailerSize;
+    if (indexOffset >= sequenceHeaderSize && indexOffset <= indexEnd - indexHeaderSize
+      && readUnalignLittleEndian<uint32_t>(pData + indexOffset) == indexMagic)
+    {
+      const uint64_t count = readUnalignLittleEndian<uint64_t>(pData + indexOffset + 4);
+      if (count == (indexEnd - indexOffset - indexHeaderSize) / indexEntrySize
+        && (indexEnd - indexOffset - indexHeaderSize) % indexEntrySize == 0)
+      {
+        m_index.resize(static_cast<size_t>(count));
+        const uint8_t* pEntry = pData + indexOffset + indexHeaderSize;
+        for (size_t i = 0; i < m_index.size(); ++i, pEntry += indexEntrySize)
+        {
+          m_index[i].frameNumber = readUnalignLittleEndian<uint32_t>(pEntry);
+          m_index[i].timestampMS = readUnalignLittleEndian<uint64_t>(pEntry + 8);
+          m_index[i].offset = readUnalignLittleEndian<uint64_t>(pEntry + 16);
+        }
+        return true;
+      }
+    }
+  }
+
+  // No valid index, the recording was not closed
+  scanChunks();
+  return true;
+}
+
+void PointCloudSequenceReader::scanChunks()
+{
+  const uint8_t* pData = m_file.getData();
+  const uint64_t size = m_file.getSize();
+  uint64_t offset = sequenceHeaderSize;
+  while (offset + 8 <= size)
+  {
+    const uint32_t magic = readUnalignLittleEndian<uint32_t>(pData + offset);
+    if (magic == frameMagic)
+    {
+      const uint32_t chunkSize = readUnalignLittleEndian<uint32_t>(pData + offset + 4);
+      if (chunkSize < frameHeaderSize || chunkSize > size - offset)
+      {
+        break;
+      }
+      PointCloudSequenceWriter::IndexEntry entry;
+      entry.frameNumber = readUnalignLittleEndian<uint32_t>(pData + offset + 8);
+      entry.timestampMS = readUnalignLittleEndian<uint64_t>(pData + offset + 16);
+      entry.offset = offset;
+      m_index.push_back(entry);
+      offset += chunkSize;
+    }
+    else if (magic == indexMagic && offset + indexHeaderSize <= size)
+    {
+      // Index of an earlier session the frames were appended to
+      const uint64_t count = readUnalignLittleEndian<uint64_t>(pData + offset + 4);
+      if (count > (size - offset - indexHeaderSize - trailerSize) / indexEntrySize)
+      {
+        break;
+      }
+      offset += indexHeaderSize + count * indexEntrySize + trailerSize;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+size_t PointCloudSequenceReader::getFrameCount() const
+{
+  return m_index.size();
+}
+
+uint32_t PointCloudSequenceReader::getFrameNumber(size_t index) const
+{
+  return m_index[index].frameNumber;
+}
+
+uint64_t PointCloudSequenceReader::getTimestampMS(size_t index) const
+{
+  return m_index[index].timestampMS;
+}
+
+bool PointCloudSequenceReader::findFrameNumber(uint32_t frameNumber, size_t& index) const
+{
+  if (m_index.empty())
+  {
+    return false;
+  }
+  if (m_consecutiveNumbers)
+  {
+    const uint32_t position = frameNumber - m_index[0].frameNumber;
+    if (position >= m_index.size())
+    {
+      return false;
+    }
+    index = position;
+    return true;
+  }
+  for (size_t i = 0; i < m_index.size(); ++i)
+  {
+    if (m_index[i].frameNumber == frameNumber)
+    {
+      index = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t PointCloudSequenceReader::findTimestamp(uint64_t timestampMS) const
+{
+  return static_cast<size_t>(std::lower_bound(m_index.begin(), m_index.end(), timestampMS,
+                                              [](const PointCloudSequenceWriter::IndexEntry& entry, uint64_t timestamp)
+                                              { return entry.timestampMS < timestamp; }) - m_index.begin());
+}
+
+bool PointCloudSequenceReader::readFrame(size_t index, PointCloudFrame& frame)
+{
+  if (index >= m_index.size())
+  {
+    return false;
+  }
+  const uint8_t* pData = m_file.getData();
+  const uint64_t size = m_file.getSize();
+  const uint64_t offset = m_index[index].offset;
+  if (offset > size || size - offset < frameHeaderSize || readUnalignLittleEndian<uint32_t>(pData + offset) != frameMagic)
+  {
+    return false;
+  }
+  const uint8_t* pChunk = pData + offset;
+  const uint32_t chunkSize = readUnalignLittleEndian<uint32_t>(pChunk + 4);
+  if (chunkSize < frameHeaderSize || chunkSize > size - offset)
+  {
+    return false;
+  }
+  frame.frameNumber = readUnalignLittleEndian<uint32_t>(pChunk + 8);
+  const uint32_t flags = readUnalignLittleEndian<uint32_t>(pChunk + 12);
+  frame.timestampMS = readUnalignLittleEndian<uint64_t>(pChunk + 16);
+  frame.width = readUnalignLittleEndian<uint32_t>(pChunk + 24);
+  frame.height = readUnalignLittleEndian<uint32_t>(pChunk + 28);
+  const uint32_t planeMask = readUnalignLittleEndian<uint32_t>(pChunk + 32);
+  const uint64_t count = static_cast<uint64_t>(frame.width) * frame.height;
+
+  const uint8_t* pPlane = pChunk + frameHeaderSize;
+  const uint8_t* pChunkEnd = pChunk + chunkSize;
+  std::vector<float>* floatPlanes[] = { &frame.x, &frame.y, &frame.z };
+  std::vector<uint16_t>* mapPlanes[] = { &frame.intensity, &frame.confidence };
+  for (uint32_t plane = 0; plane < numPlanes; ++plane)
+  {
+    const bool isFloatPlane = plane < 3;
+    if ((planeMask & (1u << plane)) == 0)
+    {
+      if (isFloatPlane)
+      {
+        floatPlanes[plane]->clear();
+      }
+      else
+      {
+        mapPlanes[plane - 3]->clear();
+      }
+      continue;
+    }
+
+    if (pChunkEnd - pPlane < 4)
+    {
+      return false;
+    }
+    const uint32_t planeSize = readUnalignLittleEndian<uint32_t>(pPlane);
+    pPlane += 4;
+    if (planeSize > static_cast<size_t>(pChunkEnd - pPlane))
+    {
+      return false;
+    }
+    if (isFloatPlane)
+    {
+      if (planeSize != count * sizeof(float))
+      {
+        return false;
+      }
+      readPlane(pPlane, static_cast<size_t>(count), *floatPlanes[plane]);
+    }
+    else if (flags & frameCompressed)
+    {
+      int width = 0;
+      int height = 0;
+      if (!m_codec.decode(pPlane, planeSize, *mapPlanes[plane - 3], width, height)
+        || static_cast<uint32_t>(width) != frame.width || static_cast<uint32_t>(height) != frame.height)
+      {
+        return false;
+      }
+    }
+    else
+    {
+      if (planeSize != count * sizeof(uint16_t))
+      {
+        return false;
+      }
+      readPlane(pPlane, static_cast<size_t>(count), *mapPlanes[plane - 3]);
+    }
+    pPlane += std::min(paddedSize(planeSize), static_cast<size_t>(pChunkEnd - pPlane));
+  }
+  return true;
+}
+
+}
@@ -0,0 +1,169 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "DepthMapCodec.h"
+#include "MappedFile.h"
+#include "PointXYZ.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// One frame of a point cloud sequence, stored column by column. Planes which are empty are not stored.
+/// The planes of an organized cloud have width x height values, an unorganized cloud has height 1.
+/// </summary>
+struct PointCloudFrame
+{
+  PointCloudFrame()
+    : frameNumber(0)
+    , timestampMS(0)
+    , width(0)
+    , height(0)
+  {
+  }
+
+  /// <summary>Split points into the X, Y and Z planes.</summary>
+  void setPoints(const std::vector<PointXYZ>& points);
+
+  /// <summary>Combine the X, Y and Z planes into points.</summary>
+  void getPoints(std::vector<PointXYZ>& points) const;
+
+  /// Frame number and timestamp of the device, see VisionaryData::getFrameNum() and getTimestampMS()
+  uint32_t frameNumber;
+  uint64_t timestampMS;
+  uint32_t width;
+  uint32_t height;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<uint16_t> intensity;
+  std::vector<uint16_t> confidence;
+};
+
+/// <summary>
+/// Writes a sequence of frames into a single file. Each frame is appended as one chunk, the index of all frames
+/// is written to the end of the file when it is closed.
+///
+/// Layout, all values little endian: header "VPS1" and version, frame chunks, index chunk, trailer.
+/// A frame chunk holds "FRM1", chunk size, frame number, flags, timestamp, width, height, plane mask and the planes,
+/// each with its size in bytes and padded to 4 bytes. The index chunk holds "IDX1", the number of frames and
+/// frame number, timestamp and file offset of each frame. The trailer is the offset of the index chunk and "VPSE".
+/// </summary>
+class PointCloudSequenceWriter
+{
+public:
+  PointCloudSequenceWriter();
+
+  /// <summary>Writes the index if the file is still open.</summary>
+  ~PointCloudSequenceWriter();
+
+  /// <summary>Open a file for writing.</summary>
+  /// <param name="filename">The file to write</param>
+  /// <param name="append">Append to the frames of an existing sequence instead of replacing the file</param>
+  /// <returns>Returns false if the file cannot be opened or the existing file is no sequence</returns>
+  bool open(const char* filename, bool append = false);
+
+  /// <summary>Write the index and close the file.</summary>
+  /// <returns>Returns false if writing failed</returns>
+  bool close();
+
+  /// <summary>Compress the intensity and confidence planes losslessly with DepthMapCodec. The default is true.</summary>
+  void setCompression(bool compress);
+
+  /// <summary>Append a frame. The sizes of all planes which are not empty have to be width x height.</summary>
+  /// <returns>Returns false if the sizes do not match, a compressed frame has more than 4096 x 4096 points
+  /// or writing failed</returns>
+  bool appendFrame(const PointCloudFrame& frame);
+
+  /// <summary>Number of frames in the file, including those of an appended sequence.</summary>
+  size_t getFrameCount() const;
+
+private:
+  struct IndexEntry
+  {
+    uint32_t frameNumber;
+    uint64_t timestampMS;
+    uint64_t offset;
+  };
+
+  std::ofstream m_file;
+  uint64_t m_offset;
+  bool m_compress;
+  std::vector<IndexEntry> m_index;
+  // Kept between frames to avoid allocations
+  std::vector<uint8_t> m_chunk;
+  std::vector<uint8_t> m_encoded;
+  DepthMapCodec m_codec;
+
+  friend class PointCloudSequenceReader;
+};
+
+/// <summary>
+/// Reads a sequence written by PointCloudSequenceWriter. The file is memory mapped and each frame is found through
+/// the index in constant time. A sequence without index, e.g. after a crash of the recording, is indexed by walking
+/// over its chunks.
+/// </summary>
+class PointCloudSequenceReader
+{
+public:
+  PointCloudSequenceReader();
+  ~PointCloudSequenceReader();
+
+  /// <summary>Map a sequence and read its index.</summary>
+  /// <returns>Returns false if the file cannot be mapped or is no sequence</returns>
+  bool open(const char* filename);
+
+  void close();
+
+  size_t getFrameCount() const;
+
+  /// <summary>Device frame number of the frame at index.</summary>
+  uint32_t getFrameNumber(size_t index) const;
+
+  /// <summary>Device timestamp of the frame at index.</summary>
+  uint64_t getTimestampMS(size_t index) const;
+
+  /// <summary>Find a frame by its device frame number.</summary>
+  /// <param name="frameNumber">Frame number to look for</param>
+  /// <param name="index">Index of the frame if found</param>
+  /// <returns>Returns false if no frame has the number</returns>
+  bool findFrameNumber(uint32_t frameNumber, size_t& index) const;
+
+  /// <summary>Index of the first frame with a timestamp at or after timestampMS, getFrameCount() if there is none.
+  /// The timestamps have to increase over the sequence.</summary>
+  size_t findTimestamp(uint64_t timestampMS) const;
+
+  /// <summary>Read the frame at index.</summary>
+  /// <returns>Returns false if the index is out of range or the frame is damaged</returns>
+  bool readFrame(size_t index, PointCloudFrame& frame);
+
+private:
+  // No copies, the mapping is owned
+  PointCloudSequenceReader(const PointCloudSequenceReader&);
+  const PointCloudSequenceReader& operator=(const PointCloudSequenceReader&);
+
+  bool readIndex();
+  void scanChunks();
+
+  MappedFile m_file;
+  std::vector<PointCloudSequenceWriter::IndexEntry> m_index;
+  // The frame numbers increase by one over the whole file, frames are found without searching
+  bool m_consecutiveNumbers;
+  DepthMapCodec m_codec;
+
+  friend class PointCloudSequenceWriter;
+};
+
+}
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace visionary 
 {
 
@@ -17,4 +19,23 @@ struct PointXYZ {
   float z;
 };
 
+// Point with the color of the corresponding RGBA map pixel
+struct PointXYZRGB {
+  float x;
+  float y;
+  float z;
+  uint8_t r;
+  uint8_t g;
+  uint8_t b;
+  uint8_t a;
+};
+
+// Point with the value of the corresponding intensity map pixel
+struct PointXYZI {
+  float x;
+  float y;
+  float z;
+  float intensity;
+};
+
 }
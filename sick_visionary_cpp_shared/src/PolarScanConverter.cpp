@@ -0,0 +1,150 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "PolarScanConverter.h"
+
+#include <cmath>
+#include <limits>
+
+namespace visionary
+{
+
+static const float bad_point = std::numeric_limits<float>::quiet_NaN();
+static const double pi = 3.14159265358979323846;
+static const size_t polarBlockSize = 64;
+
+PolarScanConverter::PolarScanConverter()
+  : m_minConfidence(0.0f)
+  , m_tableStartAngle(0.0f)
+  , m_tableAngularResolution(0.0f)
+  , m_tableSize(0)
+{
+  clearTransform();
+}
+
+PolarScanConverter::~PolarScanConverter()
+{
+}
+
+void PolarScanConverter::setMinConfidence(float minConfidence)
+{
+  m_minConfidence = minConfidence;
+}
+
+void PolarScanConverter::setTransform(const double matrix[4 * 4])
+{
+  for (int i = 0; i < 3 * 4; ++i)
+  {
+    m_transform[i] = static_cast<float>(matrix[i]);
+  }
+}
+
+void PolarScanConverter::clearTransform()
+{
+  for (int i = 0; i < 3 * 4; ++i)
+  {
+    m_transform[i] = (i % 5 == 0) ? 1.0f : 0.0f;
+  }
+}
+
+void PolarScanConverter::updateBeamTable(float startAngle, float angularResolution, size_t numBeams)
+{
+  if (numBeams == m_tableSize && startAngle == m_tableStartAngle && angularResolution == m_tableAngularResolution)
+  {
+    return;
+  }
+  m_cos.resize(numBeams);
+  m_sin.resize(numBeams);
+  for (size_t i = 0; i < numBeams; ++i)
+  {
+    const double angle = (static_cast<double>(startAngle) + static_cast<double>(i) * angularResolution) * pi / 180.;
+    m_cos[i] = static_cast<float>(std::cos(angle));
+    m_sin[i] = static_cast<float>(std::sin(angle));
+  }
+  m_tableStartAngle = startAngle;
+  m_tableAngularResolution = angularResolution;
+  m_tableSize = numBeams;
+}
+
+bool PolarScanConverter::convert(const VisionaryTData& data, std::vector<PointXYZ>& points, bool dropInvalid)
+{
+  if (data.getPolarDistanceData().empty())
+  {
+    points.clear();
+    return false;
+  }
+  return convert(data.getPolarDistanceData(), data.getPolarConfidenceData(), data.getPolarStartAngle(),
+                 data.getPolarAngularResolution(), points, dropInvalid);
+}
+
+bool PolarScanConverter::convert(const std::vector<float>& distances, const std::vector<float>& confidences,
+                                 float startAngle, float angularResolution, std::vector<PointXYZ>& points,
+                                 bool dropInvalid)
+{
+  const size_t numBeams = distances.size();
+  if (!confidences.empty() && confidences.size() != numBeams)
+  {
+    points.clear();
+    return false;
+  }
+  updateBeamTable(startAngle, angularResolution, numBeams);
+  points.resize(numBeams);
+
+  // Without confidences the distances are checked against a threshold they always pass
+  const float* pConfidence = confidences.empty() ? distances.data() : confidences.data();
+  const float minConfidence = confidences.empty() ? -std::numeric_limits<float>::infinity() : m_minConfidence;
+  const float* pDistance = distances.data();
+  const float* pCos = m_cos.data();
+  const float* pSin = m_sin.data();
+  PointXYZ* pPoints = points.data();
+  const float maxDistance = std::numeric_limits<float>::max();
+  const float m0 = m_transform[0], m1 = m_transform[1], m3 = m_transform[3];
+  const float m4 = m_transform[4], m5 = m_transform[5], m7 = m_transform[7];
+  const float m8 = m_transform[8], m9 = m_transform[9], m11 = m_transform[11];
+  const uint8_t keepInvalid = dropInvalid ? 0u : 1u;
+
+  // The beams are converted in blocks into separate x, y and z buffers, which the compiler vectorizes,
+  // and then interleaved into the points. The identity is used if no transform is set.
+  size_t numPoints = 0;
+  for (size_t blockBegin = 0; blockBegin < numBeams; blockBegin += polarBlockSize)
+  {
+    const size_t blockSize = (numBeams - blockBegin < polarBlockSize) ? numBeams - blockBegin : polarBlockSize;
+    float blockX[polarBlockSize];
+    float blockY[polarBlockSize];
+    float blockZ[polarBlockSize];
+    uint8_t blockValid[polarBlockSize];
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+      const float distance = pDistance[blockBegin + i];
+      const float confidence = pConfidence[blockBegin + i];
+      const bool valid = (distance > 0.0f) & (distance <= maxDistance) & (confidence >= minConfidence);
+      // Invalid beams are scaled by NaN, which propagates into all coordinates
+      const float scale = valid ? distance : bad_point;
+      const float x = scale * pCos[blockBegin + i];
+      const float y = scale * pSin[blockBegin + i];
+      blockX[i] = m0 * x + m1 * y + m3;
+      blockY[i] = m4 * x + m5 * y + m7;
+      blockZ[i] = m8 * x + m9 * y + m11;
+      blockValid[i] = valid ? 1u : 0u;
+    }
+
+    // Compaction without branches, see VisionaryData::generatePointCloud. Without dropInvalid every beam is kept.
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+      PointXYZ& point = pPoints[numPoints];
+      point.x = blockX[i];
+      point.y = blockY[i];
+      point.z = blockZ[i];
+      numPoints += (blockValid[i] | keepInvalid) ? 1u : 0u;
+    }
+  }
+  points.resize(numPoints);
+  return true;
+}
+
+}
@@ -0,0 +1,78 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "PointXYZ.h"
+#include "VisionaryTData.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Converts the polar 2D scans of the Visionary-T (VisionaryTData::getPolarDistanceData()) to points.
+/// Beam i has the angle startAngle + i * angularResolution (in degrees) and is placed in the scan plane
+/// at x = distance * cos(angle), y = distance * sin(angle), z = 0, in the unit of the distances.
+/// The sine and cosine of the beams are kept in a table which is only calculated again when the
+/// start angle, the resolution or the number of beams changes.
+/// </summary>
+class PolarScanConverter
+{
+public:
+  PolarScanConverter();
+  ~PolarScanConverter();
+
+  /// <summary>Beams with a lower confidence (RSSI) are invalid. The default of 0 keeps all beams.</summary>
+  void setMinConfidence(float minConfidence);
+
+  /// <summary>Transform the points after the conversion, e.g. from the scan plane to world coordinates.</summary>
+  /// <param name="matrix">Row major 4x4 matrix like CameraParameters::cam2worldMatrix. The translation has to be
+  /// in the unit of the distances.</param>
+  void setTransform(const double matrix[4 * 4]);
+
+  /// <summary>Remove the transform set by setTransform.</summary>
+  void clearTransform();
+
+  /// <summary>Convert the polar scan of the last frame.</summary>
+  /// <param name="data">Data of a frame containing the polar data set</param>
+  /// <param name="points">Converted points. The data is resized and only contains the new points.</param>
+  /// <param name="dropInvalid">If true invalid beams are left out, otherwise they are NaN and points[i] belongs to beam i</param>
+  /// <returns>Returns false if the frame contains no polar scan</returns>
+  bool convert(const VisionaryTData& data, std::vector<PointXYZ>& points, bool dropInvalid = false);
+
+  /// <summary>Convert a polar scan.</summary>
+  /// <param name="distances">Distance of each beam, values which are not positive or not finite are invalid</param>
+  /// <param name="confidences">Confidence of each beam, may be empty if the confidence is not checked</param>
+  /// <param name="startAngle">Angle of the first beam in degrees</param>
+  /// <param name="angularResolution">Angle between two beams in degrees</param>
+  /// <param name="points">Converted points. The data is resized and only contains the new points.</param>
+  /// <param name="dropInvalid">If true invalid beams are left out, otherwise they are NaN and points[i] belongs to beam i</param>
+  /// <returns>Returns false if there are confidences which do not match the number of distances</returns>
+  bool convert(const std::vector<float>& distances, const std::vector<float>& confidences, float startAngle,
+               float angularResolution, std::vector<PointXYZ>& points, bool dropInvalid = false);
+
+private:
+  // Recalculate the sine and cosine table if the beams changed
+  void updateBeamTable(float startAngle, float angularResolution, size_t numBeams);
+
+  float m_minConfidence;
+  // Row major 3x4 part of the transform, identity if no transform is set
+  float m_transform[3 * 4];
+
+  // Key of the beam table
+  float m_tableStartAngle;
+  float m_tableAngularResolution;
+  size_t m_tableSize;
+  std::vector<float> m_cos;
+  std::vector<float> m_sin;
+};
+
+}
@@ -0,0 +1,73 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "SortingNetwork.h"
+
+namespace visionary
+{
+
+SortingNetwork::SortingNetwork(size_t size, size_t outputIndex)
+  : m_size(size)
+{
+  // Batcher's odd-even merge sort for the next power of two. Comparators touching the padding are dropped:
+  // the padding can be thought of as +infinity, which stays in place at the upper end of every comparator.
+  size_t paddedSize = 1;
+  while (paddedSize < size)
+  {
+    paddedSize *= 2;
+  }
+  for (size_t p = 1; p < paddedSize; p *= 2)
+  {
+    for (size_t k = p; k >= 1; k /= 2)
+    {
+      for (size_t j = k % p; j + k < paddedSize; j += 2 * k)
+      {
+        for (size_t i = 0; i < k && i + j + k < paddedSize; ++i)
+        {
+          if ((i + j) / (2 * p) == (i + j + k) / (2 * p) && i + j + k < size)
+          {
+            Comparator comparator;
+            comparator.low = i + j;
+            comparator.high = i + j + k;
+            m_comparators.push_back(comparator);
+          }
+        }
+      }
+    }
+  }
+
+  if (outputIndex < size)
+  {
+    // Walk backwards and keep only the comparators the requested output depends on
+    std::vector<bool> needed(size, false);
+    needed[outputIndex] = true;
+    std::vector<Comparator> selection;
+    for (std::vector<Comparator>::reverse_iterator it = m_comparators.rbegin(); it != m_comparators.rend(); ++it)
+    {
+      if (needed[it->low] || needed[it->high])
+      {
+        needed[it->low] = true;
+        needed[it->high] = true;
+        selection.insert(selection.begin(), *it);
+      }
+    }
+    m_comparators.swap(selection);
+  }
+}
+
+size_t SortingNetwork::getSize() const
+{
+  return m_size;
+}
+
+size_t SortingNetwork::getComparatorCount() const
+{
+  return m_comparators.size();
+}
+
+}
@@ -0,0 +1,69 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace visionary
+{
+
+/// <summary>
+/// Fixed sequence of compare and exchange operations which sorts a fixed number of values (Batcher's odd-even merge sort).
+/// The network is applied to many independent sets of values at once: value k of all sets is stored contiguously
+/// in lane k, so each compare and exchange is a plain min/max loop over the lanes, which the compiler vectorizes.
+/// </summary>
+class SortingNetwork
+{
+public:
+  /// <summary>Build the network.</summary>
+  /// <param name="size">Number of values to sort</param>
+  /// <param name="outputIndex">If smaller than size, only the comparators needed to get the value at this index of
+  /// the sorted sequence are kept, e.g. size / 2 gives a median network. The other outputs are undefined then.</param>
+  explicit SortingNetwork(size_t size, size_t outputIndex = static_cast<size_t>(-1));
+
+  /// <summary>Number of values sorted by the network.</summary>
+  size_t getSize() const;
+
+  /// <summary>Number of compare and exchange operations of the network.</summary>
+  size_t getComparatorCount() const;
+
+  /// <summary>Apply the network to count sets of values.</summary>
+  /// <param name="lanes">Values, value k of set i is stored at lanes[k * laneStride + i]</param>
+  /// <param name="laneStride">Distance between two lanes in elements, at least count</param>
+  /// <param name="count">Number of sets</param>
+  template <typename T>
+  void apply(T* lanes, size_t laneStride, size_t count) const
+  {
+    for (std::vector<Comparator>::const_iterator it = m_comparators.begin(); it != m_comparators.end(); ++it)
+    {
+      T* pLow = lanes + it->low * laneStride;
+      T* pHigh = lanes + it->high * laneStride;
+      for (size_t i = 0; i < count; ++i)
+      {
+        const T a = pLow[i];
+        const T b = pHigh[i];
+        pLow[i] = (b < a) ? b : a;
+        pHigh[i] = (b < a) ? a : b;
+      }
+    }
+  }
+
+private:
+  struct Comparator
+  {
+    size_t low;
+    size_t high;
+  };
+
+  size_t m_size;
+  std::vector<Comparator> m_comparators;
+};
+
+}
@@ -0,0 +1,228 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "TemporalDepthFilter.h"
+
+#include <algorithm>
+
+#include "ParallelFor.h"
+
+namespace visionary
+{
+
+// Pixels are processed in blocks of this size, see DepthMapFilter
+static const size_t temporalBlockSize = 64;
+
+const size_t TemporalDepthFilter::MAX_HISTORY_LENGTH;
+
+static inline bool isValidDepth(uint16_t value)
+{
+  return (value != 0) & (value != uint16_t(0xFFFF));
+}
+
+static size_t clampHistoryLength(size_t historyLength)
+{
+  return std::min(std::max(historyLength, size_t(1)), TemporalDepthFilter::MAX_HISTORY_LENGTH);
+}
+
+TemporalDepthFilter::TemporalDepthFilter(size_t historyLength, Mode mode, uint16_t motionThreshold)
+  : m_historyLength(clampHistoryLength(historyLength))
+  , m_mode(mode)
+  , m_motionThreshold(motionThreshold)
+  , m_numThreads(1)
+  , m_medianNetwork(clampHistoryLength(historyLength), clampHistoryLength(historyLength) / 2)
+  , m_pixelCount(0)
+  , m_width(0)
+  , m_height(0)
+  , m_changeCounter(0)
+  , m_head(0)
+{
+}
+
+TemporalDepthFilter::~TemporalDepthFilter()
+{
+}
+
+void TemporalDepthFilter::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+void TemporalDepthFilter::reset()
+{
+  m_pixelCount = 0;
+}
+
+void TemporalDepthFilter::resize(size_t pixelCount)
+{
+  m_history.resize(m_historyLength * pixelCount);
+  m_estimate.resize(pixelCount);
+  m_sum.resize((m_mode == MEAN) ? pixelCount : 0);
+  // The ages are all that has to be cleared, the other buffers are only read for pixels with a history
+  m_age.assign(pixelCount, 0);
+  m_head = 0;
+  m_pixelCount = pixelCount;
+}
+
+bool TemporalDepthFilter::apply(std::vector<uint16_t>& map, const VisionaryData& data)
+{
+  return apply(map, data.getWidth(), data.getHeight(), data.getChangeCounter());
+}
+
+bool TemporalDepthFilter::apply(std::vector<uint16_t>& map, int width, int height, uint32_t changeCounter)
+{
+  if (width <= 0 || height <= 0 || map.size() != static_cast<size_t>(width) * static_cast<size_t>(height))
+  {
+    return false;
+  }
+  if (m_pixelCount == 0 || width != m_width || height != m_height || changeCounter != m_changeCounter)
+  {
+    resize(map.size());
+    m_width = width;
+    m_height = height;
+    m_changeCounter = changeCounter;
+  }
+
+  if (m_mode == MEAN)
+  {
+    applyMean(map.data(), map.size());
+  }
+  else
+  {
+    applyMedian(map.data(), map.size());
+  }
+  m_head = (m_head + 1 == m_historyLength) ? 0 : m_head + 1;
+  return true;
+}
+
+void TemporalDepthFilter::applyMean(uint16_t* pMap, size_t pixelCount)
+{
+  const int historyLength = static_cast<int>(m_historyLength);
+  const int threshold = m_motionThreshold;
+  uint16_t* pSlot = m_history.data() + m_head * pixelCount;
+  uint8_t* pAge = m_age.data();
+  uint16_t* pEstimate = m_estimate.data();
+  uint32_t* pSum = m_sum.data();
+
+  parallelFor(pixelCount, m_numThreads, [=](size_t begin, size_t end)
+  {
+    for (size_t i = begin; i < end; ++i)
+    {
+      const uint16_t value = pMap[i];
+      // The slot written historyLength frames ago, it only belongs to the history if the pixel is that old
+      const uint16_t oldest = pSlot[i];
+      const int age = pAge[i];
+      const uint32_t sum = pSum[i];
+      const int diff = value - pEstimate[i];
+
+      const bool valid = isValidDepth(value);
+      const bool moved = (threshold > 0) & ((diff > threshold) | (diff < -threshold));
+      const bool restart = !valid | moved | (age == 0);
+
+      const int keptAge = restart ? 0 : age;
+      const uint32_t keptSum = restart ? 0u : sum - ((keptAge == historyLength) ? oldest : 0u);
+      const int newAge = valid ? ((keptAge == historyLength) ? historyLength : keptAge + 1) : 0;
+      const uint32_t newSum = keptSum + (valid ? value : 0u);
+
+      // Without history (invalid pixel) the division gives NaN, which must not be converted
+      const float mean = static_cast<float>(newSum) / static_cast<float>(newAge) + 0.5f;
+      const float usedMean = valid ? mean : 0.0f;
+      const uint16_t filtered = valid ? static_cast<uint16_t>(usedMean) : value;
+
+      pSlot[i] = value;
+      pAge[i] = static_cast<uint8_t>(newAge);
+      pSum[i] = newSum;
+      pEstimate[i] = filtered;
+      pMap[i] = filtered;
+    }
+  });
+}
+
+void TemporalDepthFilter::applyMedian(uint16_t* pMap, size_t pixelCount)
+{
+  const size_t historyLength = m_historyLength;
+  const int threshold = m_motionThreshold;
+  const size_t head = m_head;
+  uint16_t* pHistory = m_history.data();
+  uint16_t* pSlot = pHistory + head * pixelCount;
+  uint8_t* pAge = m_age.data();
+  uint16_t* pEstimate = m_estimate.data();
+  const SortingNetwork* pNetwork = &m_medianNetwork;
+
+  parallelFor(pixelCount, m_numThreads, [=](size_t begin, size_t end)
+  {
+    // The uint8_t stores could alias the captured pointers, local copies keep them in registers
+    uint16_t* const pOut = pMap;
+    uint16_t* const pCurrentSlot = pSlot;
+    uint8_t* const pPixelAge = pAge;
+    uint16_t* const pPixelEstimate = pEstimate;
+    const int length = static_cast<int>(historyLength);
+    const int motionThreshold = threshold;
+    uint16_t lanes[MAX_HISTORY_LENGTH * temporalBlockSize];
+    uint8_t ages[temporalBlockSize];
+    uint8_t lowFills[temporalBlockSize];
+
+    for (size_t blockBegin = begin; blockBegin < end; blockBegin += temporalBlockSize)
+    {
+      const size_t blockSize = std::min(end - blockBegin, temporalBlockSize);
+
+      // Update the history of each pixel like in the mean mode
+      for (size_t i = 0; i < blockSize; ++i)
+      {
+        const size_t pixel = blockBegin + i;
+        const uint16_t value = pOut[pixel];
+        const int age = pPixelAge[pixel];
+        const int diff = value - pPixelEstimate[pixel];
+
+        const bool valid = isValidDepth(value);
+        const bool moved = (motionThreshold > 0) & ((diff > motionThreshold) | (diff < -motionThreshold));
+        const bool restart = !valid | moved | (age == 0);
+
+        const int keptAge = restart ? 0 : age;
+        const int newAge = valid ? ((keptAge == length) ? keptAge : keptAge + 1) : 0;
+        pCurrentSlot[pixel] = value;
+        pPixelAge[pixel] = static_cast<uint8_t>(newAge);
+        ages[i] = static_cast<uint8_t>(newAge);
+        // Slots not belonging to the history are filled half with the lowest and half with the highest value,
+        // so the median of all slots is the median of the history
+        lowFills[i] = static_cast<uint8_t>((length - newAge + 1) / 2);
+      }
+
+      // Gather the slots ordered by their age, framesAgo 0 is the map just added
+      for (size_t framesAgo = 0; framesAgo < historyLength; ++framesAgo)
+      {
+        const size_t slot = (head >= framesAgo) ? head - framesAgo : head + historyLength - framesAgo;
+        const uint16_t* pSrc = pHistory + slot * pixelCount + blockBegin;
+        uint16_t* pLane = lanes + framesAgo * temporalBlockSize;
+        const int f = static_cast<int>(framesAgo);
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+          const uint16_t value = pSrc[i];
+          const int age = ages[i];
+          const uint16_t fill = (f < age + lowFills[i]) ? uint16_t(0) : uint16_t(0xFFFF);
+          pLane[i] = (f < age) ? value : fill;
+        }
+      }
+
+      pNetwork->apply(lanes, temporalBlockSize, blockSize);
+
+      const uint16_t* pMedian = lanes + (historyLength / 2) * temporalBlockSize;
+      for (size_t i = 0; i < blockSize; ++i)
+      {
+        const size_t pixel = blockBegin + i;
+        const uint16_t value = pOut[pixel];
+        const uint16_t median = pMedian[i];
+        const uint16_t filtered = (ages[i] != 0) ? median : value;
+        pPixelEstimate[pixel] = filtered;
+        pOut[pixel] = filtered;
+      }
+    }
+  });
+}
+
+}
@@ -0,0 +1,99 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "SortingNetwork.h"
+#include "VisionaryData.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Filter over the last frames of a distance or Z map, trading latency for noise in static scenes.
+/// The last historyLength maps are kept in a ring which is only allocated when the filter is reset, so the filter
+/// does not allocate memory while the configuration of the device stays the same.
+/// Each pixel keeps its own history: it starts over when the pixel gets invalid or when the new value differs
+/// from the filtered value by more than the motion threshold, so moving objects do not leave trails.
+/// </summary>
+class TemporalDepthFilter
+{
+public:
+  enum Mode
+  {
+    /// Mean of the history of each pixel
+    MEAN,
+    /// Median of the history of each pixel, removes outliers but needs more time
+    MEDIAN
+  };
+
+  /// <summary>Maximum number of frames kept in the history.</summary>
+  static const size_t MAX_HISTORY_LENGTH = 64;
+
+  /// <summary>Create the filter.</summary>
+  /// <param name="historyLength">Number of frames to filter over, 1 to MAX_HISTORY_LENGTH</param>
+  /// <param name="mode">How the history is combined</param>
+  /// <param name="motionThreshold">Difference to the filtered value in map units which restarts the history of a pixel,
+  /// 0 disables the check</param>
+  TemporalDepthFilter(size_t historyLength, Mode mode = MEAN, uint16_t motionThreshold = 0);
+  ~TemporalDepthFilter();
+
+  /// <summary>Set the number of threads the pixels are split on, 0 uses one thread per hardware thread.
+  /// The default is 1.</summary>
+  void setNumThreads(unsigned numThreads);
+
+  /// <summary>Add the map to the history and replace it by the filtered map. Invalid pixels (0, 0xFFFF) stay invalid.
+  /// The history is cleared if the size of the map or the change counter differs from the last call.</summary>
+  /// <param name="map">Distance or Z map, filtered in place</param>
+  /// <param name="width">Width of the map in pixels</param>
+  /// <param name="height">Height of the map in pixels</param>
+  /// <param name="changeCounter">Change counter of the XML Metadata the map belongs to</param>
+  /// <returns>Returns false if the size of map does not match width x height</returns>
+  bool apply(std::vector<uint16_t>& map, int width, int height, uint32_t changeCounter);
+
+  /// <summary>Same as above, the size and change counter are taken from the data the map belongs to.</summary>
+  bool apply(std::vector<uint16_t>& map, const VisionaryData& data);
+
+  /// <summary>Clear the history, the next map is passed through unchanged.</summary>
+  void reset();
+
+private:
+  // Allocate the history for maps of pixelCount pixels and clear it
+  void resize(size_t pixelCount);
+
+  void applyMean(uint16_t* pMap, size_t pixelCount);
+  void applyMedian(uint16_t* pMap, size_t pixelCount);
+
+  size_t m_historyLength;
+  Mode m_mode;
+  uint16_t m_motionThreshold;
+  unsigned m_numThreads;
+  SortingNetwork m_medianNetwork;
+
+  // State of the last frame, a reset is forced on the next call if m_pixelCount is 0
+  size_t m_pixelCount;
+  int m_width;
+  int m_height;
+  uint32_t m_changeCounter;
+
+  // Ring slot which is overwritten by the next map
+  size_t m_head;
+  // m_historyLength maps, slot after slot
+  std::vector<uint16_t> m_history;
+  // Number of frames in the history of each pixel since its last restart
+  std::vector<uint8_t> m_age;
+  // Filtered value of each pixel of the last frame, used for motion detection
+  std::vector<uint16_t> m_estimate;
+  // Sum over the history of each pixel (mean mode only)
+  std::vector<uint32_t> m_sum;
+};
+
+}
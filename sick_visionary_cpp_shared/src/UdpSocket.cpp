@@ -10,6 +10,10 @@
 
 #include "UdpSocket.h"
 
+#ifndef _WIN32
+#include <sys/select.h>
+#endif
+
 namespace visionary 
 {
 
@@ -86,6 +90,32 @@ int UdpSocket::send(const std::vector<std::uint8_t>& buffer)
   return sendto(m_socket, reinterpret_cast<const char*>(buffer.data()), (int)buffer.size(), 0, (struct sockaddr*) &m_udpAddr, sizeof(m_udpAddr));
 }
 
+int UdpSocket::sendTo(const std::vector<std::uint8_t>& buffer, const std::string& address, uint16_t port)
+{
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = port;
+  addr.sin_addr.s_addr = inet_addr(address.c_str());
+  return sendto(m_socket, reinterpret_cast<const char*>(buffer.data()), (int)buffer.size(), 0, (struct sockaddr*) &addr, sizeof(addr));
+}
+
+bool UdpSocket::waitForData(int timeout_ms)
+{
+  if (timeout_ms < 0)
+  {
+    timeout_ms = 0;
+  }
+  fd_set readSet;
+  FD_ZERO(&readSet);
+  FD_SET(m_socket, &readSet);
+  struct timeval tv;
+  tv.tv_sec = timeout_ms / 1000;
+  tv.tv_usec = (timeout_ms % 1000) * 1000;
+  // the first parameter is ignored on Windows
+  return select((int)m_socket + 1, &readSet, NULL, NULL, &tv) > 0;
+}
+
 int UdpSocket::recv(std::vector<std::uint8_t>& buffer, std::size_t maxBytesToReceive)
 {
   // receive from TCP Socket
@@ -45,6 +45,22 @@ public:
   int shutdown();
 
   int send(const std::vector<std::uint8_t>& buffer) override;
+
+  /// Send a datagram to another address than the one given to connect
+  ///
+  /// \param[in] buffer  bytes to send.
+  /// \param[in] address IPv4 address, e.g. a broadcast address.
+  /// \param[in] port    port in network byte order.
+  ///
+  /// \return number of bytes sent, negative values are OS error codes.
+  int sendTo(const std::vector<std::uint8_t>& buffer, const std::string& address, uint16_t port);
+
+  /// Wait until a datagram can be received
+  ///
+  /// \param[in] timeout_ms longest time to wait.
+  ///
+  /// \return true if recv will not block, false on timeout or errors.
+  bool waitForData(int timeout_ms);
   int recv(std::vector<std::uint8_t>& buffer, std::size_t maxBytesToReceive) override;
   int read(std::vector<std::uint8_t>& buffer, std::size_t nBytesToReceive) override;
 
@@ -6,172 +6,397 @@
 // SICK AG, Waldkirch
 // email: TechSupport0905@sick.de
 
-#if (_MSC_VER >= 1700)
-
-#include <sstream>
-#include <memory>
-
-#include <string>
-#include <random>
+#include <algorithm>
 #include <chrono>
-
-#include <boost/property_tree/ptree.hpp>
-#include <boost/property_tree/xml_parser.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
 
 #include "VisionaryAutoIPScan.h"
+#include "VisionaryEndian.h"
 #include "UdpSocket.h"
 
+#ifndef _WIN32
+#include <ifaddrs.h>
+#include <net/if.h>
+#endif
+
 namespace visionary 
 {
 
-namespace pt = boost::property_tree;
+namespace
+{
 
-VisionaryAutoIPScan::VisionaryAutoIPScan()
+// AutoIP telegram: command, reserved, payload length, MAC address, telegram id, reserved
+const size_t kHeaderSize = 16u;
+const size_t kMaxPacketSize = 1400u;
+const uint8_t kDiscoverCommand = 0x10;
+const uint8_t kAnswerCommand = 0x90;
+
+void appendUnique(std::vector<std::string>& addresses, const std::string& address)
 {
+  for (size_t i = 0; i < addresses.size(); i++)
+  {
+    if (addresses[i] == address)
+    {
+      return;
+    }
+  }
+  addresses.push_back(address);
 }
 
-VisionaryAutoIPScan::~VisionaryAutoIPScan()
+void appendBroadcastAddress(std::vector<std::string>& addresses, uint32_t address, uint32_t netmask)
 {
+  struct in_addr broadcast;
+  // network byte order, the host part is set to ones
+  broadcast.s_addr = address | ~netmask;
+  char text[INET_ADDRSTRLEN];
+  if (inet_ntop(AF_INET, &broadcast, text, sizeof(text)) != NULL)
+  {
+    appendUnique(addresses, text);
+  }
 }
 
-std::vector<VisionaryAutoIPScan::DeviceInfo> VisionaryAutoIPScan::doScan(int timeOut, const std::string& broadcastAddress, uint16_t port)
+// Broadcast addresses of all IPv4 interfaces which are up, without loopback
+void appendInterfaceBroadcastAddresses(std::vector<std::string>& addresses)
 {
-  // Init Random generator
-  std::random_device rd;
-  std::default_random_engine mt(rd());
-  unsigned int teleIdCounter = mt();
-  std::vector<VisionaryAutoIPScan::DeviceInfo> deviceList;
-
-  std::unique_ptr<UdpSocket> pTransport(new UdpSocket());
-
-  if (pTransport->connect(broadcastAddress, htons(port)) != 0)
-  {
-    return deviceList;
-  }
-
-  // AutoIP Discover Packet
-  std::vector<uint8_t> autoIpPacket;
-  autoIpPacket.push_back(0x10); //CMD
-  autoIpPacket.push_back(0x0); //reserved
-  //length of datablock
-  autoIpPacket.push_back(0x0);
-  autoIpPacket.push_back(0x0);
-  //Mac address
-  autoIpPacket.push_back(0xFF);
-  autoIpPacket.push_back(0xFF);
-  autoIpPacket.push_back(0xFF);
-  autoIpPacket.push_back(0xFF);
-  autoIpPacket.push_back(0xFF);
-  autoIpPacket.push_back(0xFF);
-  // telgram id
-  autoIpPacket.push_back(0x0);
-  autoIpPacket.push_back(0x0);
-  autoIpPacket.push_back(0x0);
-  autoIpPacket.push_back(0x0);
-  //reserved
-  autoIpPacket.push_back(0x0);
-  autoIpPacket.push_back(0x0);
-
-  // Replace telegram id in packet
-  unsigned int curtelegramID = teleIdCounter++;
-  memcpy(&autoIpPacket.data()[10], &curtelegramID, 4u);
-
-  // Send Packet
-  pTransport->send(autoIpPacket);
-
-  // Check for answers to Discover Packet
-  const std::chrono::steady_clock::time_point startTime(std::chrono::steady_clock::now());
-  while (true)
-  {
-    std::vector<std::uint8_t> receiveBuffer;
-    const std::chrono::steady_clock::time_point now(std::chrono::steady_clock::now());
-    if ((now - startTime) > std::chrono::milliseconds(timeOut))
+#ifdef _WIN32
+  // Winsock is started by the socket of the scan
+  SOCKET s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (s == INVALID_SOCKET)
+  {
+    return;
+  }
+  INTERFACE_INFO interfaces[64];
+  DWORD bytes = 0;
+  if (WSAIoctl(s, SIO_GET_INTERFACE_LIST, NULL, 0, interfaces, sizeof(interfaces), &bytes, NULL, NULL) != SOCKET_ERROR)
+  {
+    for (size_t i = 0; i < bytes / sizeof(INTERFACE_INFO); i++)
     {
-      break;
+      const u_long flags = interfaces[i].iiFlags;
+      if ((flags & IFF_UP) && (flags & IFF_BROADCAST) && !(flags & IFF_LOOPBACK))
+      {
+        appendBroadcastAddress(addresses, interfaces[i].iiAddress.AddressIn.sin_addr.s_addr,
+                               interfaces[i].iiNetmask.AddressIn.sin_addr.s_addr);
+      }
     }
-    if (pTransport->recv(receiveBuffer, 1400) > 16) // 16 bytes minsize
+  }
+  closesocket(s);
+#else
+  struct ifaddrs* pInterfaces = NULL;
+  if (getifaddrs(&pInterfaces) != 0)
+  {
+    return;
+  }
+  for (struct ifaddrs* p = pInterfaces; p != NULL; p = p->ifa_next)
+  {
+    if (p->ifa_addr != NULL && p->ifa_netmask != NULL && p->ifa_addr->sa_family == AF_INET
+      && (p->ifa_flags & IFF_UP) && (p->ifa_flags & IFF_BROADCAST) && !(p->ifa_flags & IFF_LOOPBACK))
     {
-      unsigned int pos = 0;
-      if (receiveBuffer[pos++] != 0x90) //0x90 = answer package id and 16 bytes minsize
+      appendBroadcastAddress(addresses, reinterpret_cast<const struct sockaddr_in*>(p->ifa_addr)->sin_addr.s_addr,
+                             reinterpret_cast<const struct sockaddr_in*>(p->ifa_netmask)->sin_addr.s_addr);
+    }
+  }
+  freeifaddrs(pInterfaces);
+#endif
+}
+
+//-----------------------------------------------
+// Minimal XML reading, the answers are flat elements with attributes only
+
+typedef std::vector<std::pair<std::string, std::string> > XmlAttributes;
+
+bool isXmlSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Replace the predefined entities and character references
+void decodeXmlText(const char* p, const char* pEnd, std::string& text)
+{
+  text.clear();
+  while (p < pEnd)
+  {
+    if (*p != '&')
+    {
+      text.push_back(*p++);
+      continue;
+    }
+    const char* pSemicolon = static_cast<const char*>(std::memchr(p, ';', static_cast<size_t>(pEnd - p)));
+    if (pSemicolon == NULL)
+    {
+      text.append(p, pEnd);
+      return;
+    }
+    const std::string entity(p + 1, pSemicolon);
+    if (entity == "amp") text.push_back('&');
+    else if (entity == "lt") text.push_back('<');
+    else if (entity == "gt") text.push_back('>');
+    else if (entity == "quot") text.push_back('"');
+    else if (entity == "apos") text.push_back('\'');
+    else if (entity.size() > 1u && entity[0] == '#')
+    {
+      const unsigned long code = (entity[1] == 'x') ? std::strtoul(entity.c_str() + 2, NULL, 16) : std::strtoul(entity.c_str() + 1, NULL, 10);
+      // the answers are ASCII, other characters are kept as they are
+      if (code > 0u && code < 128u) text.push_back(static_cast<char>(code));
+      else text.append(p, pSemicolon + 1);
+    }
+    else
+    {
+      text.append(p, pSemicolon + 1);
+    }
+    p = pSemicolon + 1;
+  }
+}
+
+// Read the next start tag from p on, skipping end tags, declarations and comments
+bool readNextElement(const char*& p, const char* pEnd, std::string& name, XmlAttributes& attributes)
+{
+  for (;;)
+  {
+    p = static_cast<const char*>(std::memchr(p, '<', static_cast<size_t>(pEnd - p)));
+    if (p == NULL)
+    {
+      return false;
+    }
+    ++p;
+    if (pEnd - p >= 3 && std::memcmp(p, "!--", 3) == 0)
+    {
+      // comments may contain '>'
+      const char* pClose = std::search(p, pEnd, "-->", "-->" + 3);
+      p = (pClose == pEnd) ? pEnd : pClose + 3;
+      continue;
+    }
+    if (p < pEnd && (*p == '/' || *p == '?' || *p == '!'))
+    {
+      continue;
+    }
+
+    const char* pName = p;
+    while (p < pEnd && !isXmlSpace(*p) && *p != '/' && *p != '>')
+    {
+      ++p;
+    }
+    name.assign(pName, p);
+    attributes.clear();
+
+    for (;;)
+    {
+      while (p < pEnd && isXmlSpace(*p))
       {
-        continue;
+        ++p;
       }
-      pos += 1; // unused byte
-      unsigned int payLoadSize = receiveBuffer[pos] << 8 | receiveBuffer[pos + 1];
-      pos += 2;
-      pos += 6; //Skip mac address(part of xml)
-      unsigned int recvTelegramID = receiveBuffer[pos] | receiveBuffer[pos + 1] << 8 | receiveBuffer[pos + 2] << 16 | receiveBuffer[pos + 3] << 24;
-      pos += 4;
-      // check if it is a response to our scan
-      if (recvTelegramID != curtelegramID)
+      if (p >= pEnd)
       {
-        continue;
+        return false;
       }
-      pos += 2; // unused
-      // Get XML Payload
-      char xmlPayload[1400];
-      memset(xmlPayload, 0, sizeof(xmlPayload));
-      memcpy(&xmlPayload, &receiveBuffer[pos], payLoadSize);
-      std::stringstream stringStream(xmlPayload);
-      try
+      if (*p == '/' || *p == '>')
       {
-        DeviceInfo dI = parseAutoIPXml(stringStream);
-        deviceList.push_back(dI);
+        return true;
       }
-      catch (...)
+      const char* pAttributeName = p;
+      while (p < pEnd && !isXmlSpace(*p) && *p != '=' && *p != '/' && *p != '>')
       {
-
+        ++p;
+      }
+      const std::string attributeName(pAttributeName, p);
+      while (p < pEnd && isXmlSpace(*p))
+      {
+        ++p;
+      }
+      if (p >= pEnd || *p != '=')
+      {
+        // attribute without value, not well formed
+        return false;
+      }
+      ++p;
+      while (p < pEnd && isXmlSpace(*p))
+      {
+        ++p;
+      }
+      if (p >= pEnd || (*p != '"' && *p != '\''))
+      {
+        return false;
+      }
+      const char quote = *p++;
+      const char* pValue = p;
+      p = static_cast<const char*>(std::memchr(p, quote, static_cast<size_t>(pEnd - p)));
+      if (p == NULL)
+      {
+        return false;
       }
+      attributes.push_back(std::make_pair(attributeName, std::string()));
+      decodeXmlText(pValue, p, attributes.back().second);
+      ++p;
+    }
+  }
+}
+
+const std::string* findAttribute(const XmlAttributes& attributes, const char* name)
+{
+  for (size_t i = 0; i < attributes.size(); i++)
+  {
+    if (attributes[i].first == name)
+    {
+      return &attributes[i].second;
     }
   }
+  return NULL;
+}
+
+}
+
+VisionaryAutoIPScan::VisionaryAutoIPScan()
+{
+}
+
+VisionaryAutoIPScan::~VisionaryAutoIPScan()
+{
+}
+
+std::vector<VisionaryAutoIPScan::DeviceInfo> VisionaryAutoIPScan::doScan(int timeOut, const std::string& broadcastAddress, uint16_t port)
+{
+  std::vector<DeviceInfo> deviceList;
+  const DeviceCallback collect = [&deviceList](const DeviceInfo& deviceInfo) { deviceList.push_back(deviceInfo); };
+  if (broadcastAddress == DEFAULT_BROADCAST_ADDR)
+  {
+    (void)scan(timeOut, collect, port);
+  }
+  else
+  {
+    (void)scanAddresses(std::vector<std::string>(1u, broadcastAddress), false, timeOut, collect, port);
+  }
   return deviceList;
 }
 
-VisionaryAutoIPScan::DeviceInfo VisionaryAutoIPScan::parseAutoIPXml(std::stringstream& rStringStream)
+bool VisionaryAutoIPScan::scan(int timeOut, const DeviceCallback& callback, uint16_t port)
 {
-  pt::ptree tree;
-  pt::read_xml(rStringStream, tree);
-  const std::string& macAddress = tree.get_child("NetScanResult.<xmlattr>.MACAddr").get_value<std::string>();
-  std::string ipAddress = "";
-  std::string subNet = "";
-  std::string port = "";
-  std::string deviceType = "";
+  return scanAddresses(std::vector<std::string>(1u, DEFAULT_BROADCAST_ADDR), true, timeOut, callback, port);
+}
+
+bool VisionaryAutoIPScan::scanAddresses(const std::vector<std::string>& broadcastAddresses, bool allInterfaces, int timeOut, const DeviceCallback& callback, uint16_t port)
+{
+  // One socket bound to any address sends on all interfaces and receives all answers,
+  // also the broadcast answers of devices outside the subnet of the interface
+  UdpSocket socket;
+  if (socket.connect(DEFAULT_BROADCAST_ADDR, htons(port)) != 0)
+  {
+    socket.shutdown();
+    return false;
+  }
+
+  std::vector<std::string> addresses(broadcastAddresses);
+  if (allInterfaces)
+  {
+    // 255.255.255.255 leaves through one interface only, the broadcast address of each interface reaches all
+    appendInterfaceBroadcastAddresses(addresses);
+  }
+
+  // AutoIP Discover Packet to all MAC addresses, with a random telegram id to recognize the answers
+  std::random_device rd;
+  const uint32_t telegramId = static_cast<uint32_t>(rd());
+  std::vector<uint8_t> autoIpPacket(kHeaderSize, 0u);
+  autoIpPacket[0] = kDiscoverCommand;
+  std::memset(&autoIpPacket[4], 0xFF, 6u);
+  writeUnalignLittleEndian<uint32_t>(&autoIpPacket[10], telegramId);
 
-  for (auto it : tree.get_child("NetScanResult"))
+  for (size_t i = 0; i < addresses.size(); i++)
   {
-    if (it.first != "<xmlattr>")
+    (void)socket.sendTo(autoIpPacket, addresses[i], htons(port));
+  }
+
+  // Report the answers as they arrive, each device once
+  std::unordered_set<std::string> macAddresses;
+  std::vector<std::uint8_t> receiveBuffer;
+  const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeOut);
+  for (;;)
+  {
+    const std::chrono::steady_clock::duration remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero())
     {
-      const std::string& key = it.second.get<std::string>("<xmlattr>.key");
-      const std::string& value = it.second.get<std::string>("<xmlattr>.value");
-      if (key == "IPAddress")
-      {
-        ipAddress = value;
-      }
+      break;
+    }
+    // round up, so the last wait does not spin
+    const int remaining_ms = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(remaining).count()) + 1;
+    if (!socket.waitForData(remaining_ms))
+    {
+      continue;
+    }
+    const int received = socket.recv(receiveBuffer, kMaxPacketSize);
+    if (received <= static_cast<int>(kHeaderSize) || receiveBuffer[0] != kAnswerCommand)
+    {
+      continue;
+    }
+    const size_t payloadSize = readUnalignBigEndian<uint16_t>(&receiveBuffer[2]);
+    if (readUnalignLittleEndian<uint32_t>(&receiveBuffer[10]) != telegramId
+      || kHeaderSize + payloadSize > static_cast<size_t>(received))
+    {
+      continue;
+    }
+    DeviceInfo deviceInfo;
+    if (parseAutoIPXml(reinterpret_cast<const char*>(&receiveBuffer[kHeaderSize]), payloadSize, deviceInfo)
+      && macAddresses.insert(deviceInfo.MacAddress).second)
+    {
+      callback(deviceInfo);
+    }
+  }
 
-      if (key == "IPMask")
-      {
-        subNet = value;
-      }
+  socket.shutdown();
+  return true;
+}
 
-      if (key == "HostPortNo")
-      {
-        port = value;
-      }
+bool VisionaryAutoIPScan::parseAutoIPXml(const char* pXml, size_t length, DeviceInfo& deviceInfo)
+{
+  const char* p = pXml;
+  const char* pEnd = pXml + length;
+  std::string name;
+  XmlAttributes attributes;
+  bool foundResult = false;
 
-      if (key == "DeviceType")
+  deviceInfo = DeviceInfo();
+  while (readNextElement(p, pEnd, name, attributes))
+  {
+    if (name == "NetScanResult")
+    {
+      const std::string* pMacAddress = findAttribute(attributes, "MACAddr");
+      if (pMacAddress != NULL)
       {
-        deviceType = value;
+        deviceInfo.MacAddress = *pMacAddress;
+        foundResult = true;
       }
+      continue;
+    }
+    const std::string* pKey = findAttribute(attributes, "key");
+    const std::string* pValue = findAttribute(attributes, "value");
+    if (pKey == NULL || pValue == NULL)
+    {
+      continue;
+    }
+    if (*pKey == "IPAddress")
+    {
+      deviceInfo.IpAddress = *pValue;
+    }
+    else if (*pKey == "IPMask")
+    {
+      deviceInfo.SubNet = *pValue;
+    }
+    else if (*pKey == "HostPortNo")
+    {
+      deviceInfo.Port = *pValue;
+    }
+    else if (*pKey == "DeviceType")
+    {
+      deviceInfo.DeviceName = *pValue;
+    }
+    else if (*pKey == "SerialNumber")
+    {
+      deviceInfo.SerialNumber = *pValue;
     }
   }
-  DeviceInfo dI;
-  dI.DeviceName = deviceType;
-  dI.IpAddress = ipAddress;
-  dI.MacAddress = macAddress;
-  dI.Port = port;
-  dI.SubNet = subNet;
-  return dI;
+  return foundResult && !deviceInfo.MacAddress.empty();
 }
 
 }
-#endif
@@ -8,6 +8,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -27,19 +30,43 @@ public:
     std::string IpAddress;
     std::string SubNet;
     std::string Port;
+    std::string SerialNumber;
   };
+
+  /// Called for each device as soon as its answer arrives
+  typedef std::function<void(const DeviceInfo& deviceInfo)> DeviceCallback;
+
   VisionaryAutoIPScan();
   ~VisionaryAutoIPScan();
 
   /// <summary>
-  /// Runs an autoIP scan and returns a list of devices
+  /// Runs an autoIP scan and returns a list of devices. With the default broadcast address the scan is sent
+  /// on all network interfaces, see <see cref="scan" />.
   /// </summary>
   /// <returns>A list of devices.</returns>
   std::vector<DeviceInfo> doScan(int timeOut, const std::string& broadcastAddress = DEFAULT_BROADCAST_ADDR, uint16_t port = DEFAULT_PORT);
 
+  /// <summary>
+  /// Runs an autoIP scan on all network interfaces at once. The discover packet is sent to the broadcast address
+  /// of each IPv4 interface and to 255.255.255.255, the answers are collected until timeOut has passed.
+  /// A device answering on several interfaces is reported once.
+  /// </summary>
+  /// <param name="timeOut">Time to wait for answers in milliseconds</param>
+  /// <param name="callback">Called for each device when its answer arrives</param>
+  /// <param name="port">AutoIP port of the devices</param>
+  /// <returns>False if the socket cannot be opened.</returns>
+  bool scan(int timeOut, const DeviceCallback& callback, uint16_t port = DEFAULT_PORT);
+
+  /// <summary>
+  /// Parse the XML payload of an autoIP answer.
+  /// </summary>
+  /// <returns>False if the payload has no NetScanResult with a MAC address.</returns>
+  static bool parseAutoIPXml(const char* pXml, size_t length, DeviceInfo& deviceInfo);
+
 private:
-  DeviceInfo parseAutoIPXml(std::stringstream& rStringStream);
-  static const short DEFAULT_PORT = 30718;
+  // send the discover packet to each address, and to the broadcast address of each interface if allInterfaces,
+  // and report the answers until timeOut
+  bool scanAddresses(const std::vector<std::string>& broadcastAddresses, bool allInterfaces, int timeOut, const DeviceCallback& callback, uint16_t port);
 };
 
 }
@@ -7,12 +7,12 @@
 // email: TechSupport0905@sick.de
 
 #include <cassert>
+#include <cstring>
 #include "VisionaryControl.h"
 #include "VisionaryEndian.h"
 #include "CoLaBProtocolHandler.h"
 #include "CoLa2ProtocolHandler.h"
 #include "TcpSocket.h"
-#include "ControlSession.h"
 #include "AuthenticationLegacy.h"
 #include "CoLaParameterWriter.h"
 #include "CoLaParameterReader.h"
@@ -26,12 +26,12 @@ VisionaryControl::VisionaryControl()
 
 VisionaryControl::~VisionaryControl()
 {
+  close();
 }
 
 bool VisionaryControl::open(ProtocolType type, const std::string& hostname, uint32_t sessionTimeout_ms)
 {
-  m_pProtocolHandler = nullptr;
-  m_pTransport = nullptr;
+  close();
 
   std::unique_ptr<TcpSocket> pTransport(new TcpSocket());
   
@@ -61,16 +61,19 @@ bool VisionaryControl::open(ProtocolType type, const std::string& hostname, uint
     return false;
   }
 
-  std::unique_ptr <ControlSession> pControlSession;
-  pControlSession = std::unique_ptr<ControlSession>(new ControlSession(*pProtocolHandler));
+  // The acquisition methods are called for every frame in triggered mode, their frames are built only once
+  pProtocolHandler->buildFrame(CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYSTART").build().getBuffer(), m_playStartFrame);
+  pProtocolHandler->buildFrame(CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYNEXT").build().getBuffer(), m_playNextFrame);
+  pProtocolHandler->buildFrame(CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYSTOP").build().getBuffer(), m_playStopFrame);
+
+  std::unique_ptr<AsyncControlClient> pClient(new AsyncControlClient());
+  pClient->open(std::move(pTransport), std::move(pProtocolHandler));
 
   std::unique_ptr <IAuthentication> pAuthentication;
   pAuthentication = std::unique_ptr<IAuthentication>(new AuthenticationLegacy(*this));
 
-  m_pTransport       = std::move(pTransport);
-  m_pProtocolHandler = std::move(pProtocolHandler);
-  m_pControlSession  = std::move(pControlSession);
-  m_pAuthentication  = std::move(pAuthentication);
+  m_pClient         = std::move(pClient);
+  m_pAuthentication = std::move(pAuthentication);
 
   return true;
 }
@@ -82,20 +85,14 @@ void VisionaryControl::close()
     (void)m_pAuthentication->logout();
     m_pAuthentication = nullptr;
   }
-  if (m_pProtocolHandler)
-  {
-    m_pProtocolHandler->closeSession();
-    m_pProtocolHandler = nullptr;
-  }
-  if (m_pTransport)
-  {
-    m_pTransport->shutdown();
-    m_pTransport = nullptr;
-  }
-  if (m_pControlSession)
+  if (m_pClient)
   {
-    m_pControlSession = nullptr;
+    // fails the acknowledgments which are still pending
+    m_pClient->close();
+    m_pClient = nullptr;
   }
+  std::lock_guard<std::mutex> lock(m_acknowledgmentMutex);
+  m_pendingAcknowledgments.clear();
 }
 
 bool VisionaryControl::login(IAuthentication::UserLevel userLevel, const std::string password)
@@ -112,10 +109,10 @@ std::string VisionaryControl::getDeviceIdent()
 {
   CoLaCommand command = CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, "DeviceIdent").build();
 
-  CoLaCommand response = m_pControlSession->send(command);
+  CoLaCommand response = m_pClient->send(command).get();
   if (response.getError() == CoLaError::OK)
   {
-    return CoLaParameterReader(response).readFlexString();
+    return CoLaParameterReader(std::move(response)).readFlexString();
   }
   else
   {
@@ -125,40 +122,140 @@ std::string VisionaryControl::getDeviceIdent()
 
 bool VisionaryControl::startAcquisition() 
 {
-  CoLaCommand command = CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYSTART").build();
-  
-  CoLaCommand response = m_pControlSession->send(command);
-
-  return response.getError() == CoLaError::OK;
+  return sendPrebuiltFrame(m_playStartFrame);
 }
 
 bool VisionaryControl::stepAcquisition() 
 {
-  CoLaCommand command = CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYNEXT").build();
-  CoLaCommand response = m_pControlSession->send(command);
-
-  return response.getError() == CoLaError::OK;
+  return sendPrebuiltFrame(m_playNextFrame);
 }
 
 bool VisionaryControl::stopAcquisition() 
 {
-  CoLaCommand command = CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "PLAYSTOP").build();
-  CoLaCommand response = m_pControlSession->send(command);
+  return sendPrebuiltFrame(m_playStopFrame);
+}
 
-  return response.getError() == CoLaError::OK;
+bool VisionaryControl::stepAcquisitionAsync()
+{
+  if (!m_pClient || !m_pClient->isOpen())
+  {
+    return false;
+  }
+  std::future<CoLaCommand> acknowledgment = m_pClient->sendFrame(m_playNextFrame);
+  // a future which is ready at once holds the network error of a failed send, or a very fast answer
+  if (acknowledgment.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+  {
+    return isAcknowledgment(acknowledgment.get());
+  }
+  std::lock_guard<std::mutex> lock(m_acknowledgmentMutex);
+  m_pendingAcknowledgments.push_back(std::move(acknowledgment));
+  return true;
+}
+
+size_t VisionaryControl::getPendingAcknowledgments() const
+{
+  std::lock_guard<std::mutex> lock(m_acknowledgmentMutex);
+  size_t pending = 0u;
+  for (size_t i = 0; i < m_pendingAcknowledgments.size(); i++)
+  {
+    if (m_pendingAcknowledgments[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+      pending++;
+    }
+  }
+  return pending;
+}
+
+bool VisionaryControl::collectAcknowledgments()
+{
+  std::deque<std::future<CoLaCommand> > acknowledgments;
+  {
+    std::lock_guard<std::mutex> lock(m_acknowledgmentMutex);
+    acknowledgments.swap(m_pendingAcknowledgments);
+  }
+  bool success = true;
+  for (size_t i = 0; i < acknowledgments.size(); i++)
+  {
+    if (!isAcknowledgment(acknowledgments[i].get()))
+    {
+      success = false;
+    }
+  }
+  return success;
+}
+
+bool VisionaryControl::sendPrebuiltFrame(std::vector<uint8_t>& frame)
+{
+  return isAcknowledgment(m_pClient->sendFrame(frame).get());
+}
+
+bool VisionaryControl::isAcknowledgment(const CoLaCommand& response)
+{
+  // a CoLa error is answered with "sFA", a network error or a truncated frame has no valid type
+  return response.getError() == CoLaError::OK && response.getType() != CoLaCommandType::UNKNOWN;
 }
 
 bool VisionaryControl::getDataStreamConfig() 
 {
   CoLaCommand command = CoLaParameterWriter(CoLaCommandType::METHOD_INVOCATION, "GetBlobClientConfig").build();
-  CoLaCommand response = m_pControlSession->send(command);
+  CoLaCommand response = m_pClient->send(command).get();
 
   return response.getError() == CoLaError::OK;
 }
 
 CoLaCommand VisionaryControl::sendCommand(CoLaCommand & command)
 {
-  return m_pControlSession->send(command);
+  return m_pClient->send(command).get();
+}
+
+std::vector<CoLaCommand> VisionaryControl::sendCommands(const std::vector<CoLaCommand>& commands)
+{
+  // a new command is sent whenever the oldest response arrived, so at most kMaxPendingRequests are on the wire
+  std::deque<std::future<CoLaCommand> > futures;
+  std::vector<CoLaCommand> responses;
+  responses.reserve(commands.size());
+  for (size_t i = 0; i < commands.size(); i++)
+  {
+    if (futures.size() == kMaxPendingRequests)
+    {
+      responses.push_back(futures.front().get());
+      futures.pop_front();
+    }
+    futures.push_back(m_pClient->send(commands[i]));
+  }
+  for (size_t i = 0; i < futures.size(); i++)
+  {
+    responses.push_back(futures[i].get());
+  }
+  return responses;
+}
+
+std::vector<CoLaCommand> VisionaryControl::readVariables(const std::vector<std::string>& varnames)
+{
+  std::vector<CoLaCommand> commands;
+  commands.reserve(varnames.size());
+  for (size_t i = 0; i < varnames.size(); i++)
+  {
+    commands.push_back(CoLaParameterWriter(CoLaCommandType::READ_VARIABLE, varnames[i].c_str()).build());
+  }
+  return sendCommands(commands);
+}
+
+AsyncControlClient& VisionaryControl::getAsyncClient()
+{
+  return *m_pClient;
+}
+
+std::vector<uint8_t>& VisionaryControl::getRequestBuffer()
+{
+  static thread_local std::vector<uint8_t> buffer;
+  return buffer;
+}
+
+std::vector<uint8_t>& VisionaryControl::getResponseBuffer()
+{
+  static thread_local std::vector<uint8_t> buffer;
+  return buffer;
 }
 
 }
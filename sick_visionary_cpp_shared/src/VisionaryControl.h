@@ -8,18 +8,30 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <deque>
+#include <future>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "AsyncControlClient.h"
 #include "CoLaCommand.h"
+#include "CoLaVariable.h"
 #include "IProtocolHandler.h"
 #include "IAuthentication.h"
 #include "TcpSocket.h"
-#include "ControlSession.h"
 
 namespace visionary 
 {
 
+/// <summary>
+/// Control connection to a device. All methods except open and close may be called from several threads at once,
+/// the connection is shared through an <see cref="AsyncControlClient" />.
+/// </summary>
 class VisionaryControl
 {
 public:
@@ -35,6 +47,13 @@ public:
   /// Default session timeout
   static const uint32_t kSessionTimeout_ms = 5000;
 
+  /// Number of commands of <see cref="sendCommands" /> sent before waiting for their responses,
+  /// bounds the data queued on the device
+  static const size_t kMaxPendingRequests = 32;
+
+  /// Default longest interval between the reads of <see cref="waitForValue" />
+  static const uint32_t kMaxPollInterval_ms = 50;
+
   VisionaryControl();
   ~VisionaryControl();
 
@@ -88,6 +107,20 @@ public:
   /// <returns>True if successful, false otherwise.</returns>
   bool stepAcquisition();
 
+  /// <summary>
+  /// Trigger a single image like <see cref="stepAcquisition" />, but return as soon as the trigger is sent.
+  /// The acknowledgment is received in the background and checked by <see cref="collectAcknowledgments" />.
+  /// </summary>
+  /// <returns>True if the trigger was sent, false otherwise.</returns>
+  bool stepAcquisitionAsync();
+
+  /// <summary>Number of triggers sent by <see cref="stepAcquisitionAsync" /> which are not acknowledged yet.</summary>
+  size_t getPendingAcknowledgments() const;
+
+  /// <summary>Wait for the acknowledgments of all triggers sent by <see cref="stepAcquisitionAsync" />.</summary>
+  /// <returns>True if all triggers were acknowledged without error, false otherwise.</returns>
+  bool collectAcknowledgments();
+
   /// <summary>
   /// Stops the data stream. Works always, also when acquisition is already stopped before.
   /// </summary>
@@ -103,15 +136,119 @@ public:
   /// <param name="command">Command to send</param>
   /// <returns>The response.</returns>
   CoLaCommand sendCommand(CoLaCommand& command);
+
+  /// <summary>Send several commands to the device and wait for all results. Up to kMaxPendingRequests commands
+  /// are sent without waiting for each response, which saves a network round trip per command.</summary>
+  /// <param name="commands">Commands to send</param>
+  /// <returns>The responses in the order of the commands.</returns>
+  std::vector<CoLaCommand> sendCommands(const std::vector<CoLaCommand>& commands);
+
+  /// <summary>Read several variables with one call of <see cref="sendCommands" />.</summary>
+  /// <param name="varnames">Names of the variables to read</param>
+  /// <returns>The read responses in the order of the names, use a CoLaParameterReader to get the values.</returns>
+  std::vector<CoLaCommand> readVariables(const std::vector<std::string>& varnames);
+
+  /// <summary>Read a variable described by a <see cref="CoLaVariable" />. The request and response buffers are
+  /// kept by this object, so repeated reads do not allocate.</summary>
+  /// <param name="variable">The variable to read</param>
+  /// <param name="value">The value read, unchanged on errors</param>
+  /// <returns>True if successful, false otherwise.</returns>
+  template <typename T>
+  bool read(const CoLaVariable<T>& variable, T& value);
+
+  /// <summary>Write a variable described by a <see cref="CoLaVariable" />.</summary>
+  /// <param name="variable">The variable to write</param>
+  /// <param name="value">The value to write</param>
+  /// <returns>True if the device acknowledged the write, false otherwise.</returns>
+  template <typename T>
+  bool write(const CoLaVariable<T>& variable, const T& value);
+
+  /// <summary>Wait until a variable has a value, e.g. until a running flag of a device method turns false.
+  /// The variable is read every millisecond at first, the interval doubles up to maxPollInterval_ms.
+  /// The reads share the connection with the commands of other threads.</summary>
+  /// <param name="variable">The bool or number variable to read, a CoLa enum is read as its integer type, e.g. uint8_t</param>
+  /// <param name="expected">The value to wait for</param>
+  /// <param name="deadline">Time after which the wait fails, the variable is read once more at the deadline</param>
+  /// <param name="maxPollInterval_ms">Longest interval between two reads, at least 1 ms</param>
+  /// <returns>True if the variable has the value, false on timeout or errors.</returns>
+  template <typename T>
+  bool waitForValue(const CoLaVariable<T>& variable, const T& expected, std::chrono::steady_clock::time_point deadline,
+                    uint32_t maxPollInterval_ms = kMaxPollInterval_ms);
+
+  /// <summary>Send commands without waiting, e.g. from several threads or with a completion callback.
+  /// Valid while the connection is open.</summary>
+  AsyncControlClient& getAsyncClient();
   
 private:
-  std::string receiveCoLaResponse();
-  CoLaCommand receiveCoLaCommand();
+  // send a prebuilt frame and wait for the acknowledgment
+  bool sendPrebuiltFrame(std::vector<uint8_t>& frame);
+  static bool isAcknowledgment(const CoLaCommand& response);
+
+  // Buffers of read<T> and write<T>, one pair per thread to avoid allocations
+  static std::vector<uint8_t>& getRequestBuffer();
+  static std::vector<uint8_t>& getResponseBuffer();
+
+  std::unique_ptr<AsyncControlClient> m_pClient;
+  std::unique_ptr<IAuthentication>    m_pAuthentication;
 
-  std::unique_ptr<TcpSocket>        m_pTransport;
-  std::unique_ptr<IProtocolHandler> m_pProtocolHandler;
-  std::unique_ptr<IAuthentication>  m_pAuthentication;
-  std::unique_ptr<ControlSession>   m_pControlSession;
+  // Complete frames of the acquisition methods, built once when the connection is opened
+  std::vector<uint8_t> m_playStartFrame;
+  std::vector<uint8_t> m_playNextFrame;
+  std::vector<uint8_t> m_playStopFrame;
+
+  // Acknowledgments of stepAcquisitionAsync
+  mutable std::mutex m_acknowledgmentMutex;
+  std::deque<std::future<CoLaCommand> > m_pendingAcknowledgments;
 };
 
+template <typename T>
+bool VisionaryControl::read(const CoLaVariable<T>& variable, T& value)
+{
+  std::vector<uint8_t>& response = getResponseBuffer();
+  return m_pClient->execute(variable.getReadRequest(), response)
+    && variable.decodeRead(response, value);
+}
+
+template <typename T>
+bool VisionaryControl::write(const CoLaVariable<T>& variable, const T& value)
+{
+  std::vector<uint8_t>& request = getRequestBuffer();
+  std::vector<uint8_t>& response = getResponseBuffer();
+  variable.encodeWrite(value, request);
+  return m_pClient->execute(request, response)
+    && variable.decodeWrite(response);
+}
+
+template <typename T>
+bool VisionaryControl::waitForValue(const CoLaVariable<T>& variable, const T& expected,
+                                    std::chrono::steady_clock::time_point deadline, uint32_t maxPollInterval_ms)
+{
+  std::vector<uint8_t>& response = getResponseBuffer();
+  // most methods finish soon, so the first reads are tight, later ones back off to spare the device
+  // an interval of 0 would read the variable back to back on the shared connection
+  const std::chrono::microseconds minInterval(1000);
+  const std::chrono::microseconds maxInterval = std::max(minInterval,
+    std::chrono::microseconds(static_cast<int64_t>(maxPollInterval_ms) * 1000));
+  std::chrono::microseconds interval = minInterval;
+  for (;;)
+  {
+    T value;
+    if (!m_pClient->execute(variable.getReadRequest(), response) || !variable.decodeRead(response, value))
+    {
+      return false;
+    }
+    if (value == expected)
+    {
+      return true;
+    }
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if (now >= deadline)
+    {
+      return false;
+    }
+    std::this_thread::sleep_for(std::min(interval, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now)));
+    interval = std::min(interval * 2, maxInterval);
+  }
+}
+
 }
@@ -13,15 +13,81 @@
 #include <cmath>
 #include <cassert>
 #include <limits>
+#include <cstring>
 
 namespace visionary 
 {
 
 const float bad_point = std::numeric_limits<float>::quiet_NaN();
 
+PointCloudThresholds::PointCloudThresholds()
+  : minConfidence(0)
+  , minIntensity(0)
+  , maxIntensity(0xFFFF)
+  , minRange(0.0f)
+  , maxRange(std::numeric_limits<float>::infinity())
+{
+}
+
+// Kernel shared by the point clouds which carry a per pixel attribute (color or intensity).
+// The attribute is copied in the same pass, so no separate gather over the attribute map is needed.
+// setAttribute(point, attribute) stores the attribute of a pixel in its point.
+template <typename PointT, typename AttributeT, typename SetAttribute>
+static void generateAttributedPointCloud(const std::vector<uint16_t>& map, const std::vector<AttributeT>& attributeMap,
+                                         const std::vector<PointXYZ>& undistorted, float pixelSizeZ, float f2rc, bool dropInvalid,
+                                         std::vector<PointT>& pointCloud, SetAttribute setAttribute)
+{
+  const size_t cloudSize = map.size();
+  if (attributeMap.size() != cloudSize)
+  {
+    pointCloud.clear();
+    return;
+  }
+  pointCloud.resize(cloudSize);
+
+  const uint16_t* pMap = map.data();
+  const AttributeT* pAttribute = attributeMap.data();
+  const PointXYZ* pUndistorted = undistorted.data();
+  PointT* pPC = pointCloud.data();
+
+  // Calculates point i, invalid points are scaled by NaN. Returns if the point is valid.
+  auto makePoint = [&](size_t i, PointT& point) -> bool
+  {
+    const uint16_t value = pMap[i];
+    const float distance = static_cast<float>(value) * pixelSizeZ;
+    const bool valid = (value != 0) & (value != uint16_t(0xFFFF));
+    const float scale = valid ? distance : bad_point;
+    point.x = pUndistorted[i].x * scale;
+    point.y = pUndistorted[i].y * scale;
+    point.z = pUndistorted[i].z * scale - f2rc;
+    setAttribute(point, pAttribute[i]);
+    return valid;
+  };
+
+  if (!dropInvalid)
+  {
+    for (size_t i = 0; i < cloudSize; ++i)
+    {
+      (void)makePoint(i, pPC[i]);
+    }
+    return;
+  }
+
+  // Compaction without branches: every point is written to the next free slot,
+  // which is only advanced for valid points.
+  size_t numPoints = 0;
+  for (size_t i = 0; i < cloudSize; ++i)
+  {
+    numPoints += makePoint(i, pPC[numPoints]) ? 1u : 0u;
+  }
+  pointCloud.resize(numPoints);
+}
+
 VisionaryData::VisionaryData()
 {
   m_frameNum = 0;
+  // No valid change counter, so the first XML Metadata part is always parsed
+  m_changeCounter = static_cast<uint_fast32_t>(-1);
   m_cameraParams.width = 0;
   m_cameraParams.height = 0;
   m_preCalcCamInfoType = VisionaryData::UNKNOWN;
@@ -59,6 +125,7 @@ void VisionaryData::preCalcCamInfo(const ImageType& imgType)
 {
   assert(imgType != UNKNOWN);     // Unknown image type for the point cloud transformation
   
+  m_preCalcCamInfo.clear();
   m_preCalcCamInfo.reserve(m_cameraParams.height * m_cameraParams.width);
 
   //-----------------------------------------------
@@ -111,48 +178,96 @@ void VisionaryData::preCalcCamInfo(const ImageType& imgType)
 }
 
 void VisionaryData::generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, std::vector<PointXYZ> &pointCloud)
+{
+  generatePointCloud(map, imgType, std::vector<uint16_t>(), std::vector<uint16_t>(), PointCloudThresholds(), pointCloud);
+}
+
+void VisionaryData::generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType,
+                                       const std::vector<uint16_t>& intensityMap, const std::vector<uint16_t>& confidenceMap,
+                                       const PointCloudThresholds& thresholds, std::vector<PointXYZ> &pointCloud)
 {
   // Calculate disortion data from XML metadata once.
   if (m_preCalcCamInfoType != imgType)
   {
     preCalcCamInfo(imgType);
   }
-  size_t cloudSize = map.size();
+  const size_t cloudSize = map.size();
   pointCloud.resize(cloudSize);
 
   const float f2rc = static_cast<float>(m_cameraParams.f2rc / 1000.f); // PointCloud should be in [m] and not in [mm]
 
   const float pixelSizeZ = m_scaleZ;
 
+  //-----------------------------------------------
+  // Maps which are not available are replaced by the distance map itself together with
+  // a threshold window that always passes. This keeps the loop below free of branches,
+  // so the compiler can turn the checks into vectorized masks.
+  const bool hasIntensity = intensityMap.size() == cloudSize;
+  const bool hasConfidence = confidenceMap.size() == cloudSize;
+  const uint16_t* pMap = map.data();
+  const uint16_t* pIntensity = hasIntensity ? intensityMap.data() : pMap;
+  const uint16_t* pConfidence = hasConfidence ? confidenceMap.data() : pMap;
+  const uint16_t minIntensity = hasIntensity ? thresholds.minIntensity : uint16_t(0);
+  const uint16_t maxIntensity = hasIntensity ? thresholds.maxIntensity : uint16_t(0xFFFF);
+  const uint16_t minConfidence = hasConfidence ? thresholds.minConfidence : uint16_t(0);
+  const float minRange = thresholds.minRange;
+  const float maxRange = thresholds.maxRange;
+
+  const PointXYZ* pUndistorted = m_preCalcCamInfo.data();
+  PointXYZ* pPC = pointCloud.data();
+
   //-----------------------------------------------
   // transform each pixel into Cartesian coordinates
-  std::vector<uint16_t>::const_iterator itMap = map.begin();
-  std::vector<PointXYZ>::iterator itUndistorted = m_preCalcCamInfo.begin();
-  std::vector<PointXYZ>::iterator itPC = pointCloud.begin();
-  for (uint32_t i = 0; i < cloudSize; ++i, ++itPC, ++itMap, ++itUndistorted)
-  //for (std::vector<PointXYZ>::iterator itPC = pointCloud.begin(), itEnd = pointCloud.end(); itPC != itEnd; ++itPC, ++itMap, ++itUndistorted)
+  for (size_t i = 0; i < cloudSize; ++i)
   {
-    PointXYZ point;
-    // If point is valid put it to point cloud
-    if (*itMap == 0 || *itMap == uint16_t(0xFFFF))
-    {
-      point.x = bad_point;
-      point.y = bad_point;
-      point.z = bad_point;
-    }
-    else
-    {
-      // calculate coordinates & store in point cloud vector
-      float distance = static_cast<float>((*itMap)) * pixelSizeZ;
-      point.x = itUndistorted->x * distance;
-      point.y = itUndistorted->y * distance;
-      point.z = itUndistorted->z * distance - f2rc;
-    }
-    *itPC = point;
+    const uint16_t value = pMap[i];
+    // calculate coordinates & store in point cloud vector
+    const float distance = static_cast<float>(value) * pixelSizeZ;
+
+    // If point is valid and passes all thresholds put it to point cloud
+    const bool valid = (value != 0) & (value != uint16_t(0xFFFF))
+                     & (distance >= minRange) & (distance <= maxRange)
+                     & (pIntensity[i] >= minIntensity) & (pIntensity[i] <= maxIntensity)
+                     & (pConfidence[i] >= minConfidence);
+
+    // Invalid points are scaled by NaN, which propagates into all three coordinates
+    const float scale = valid ? distance : bad_point;
+    pPC[i].x = pUndistorted[i].x * scale;
+    pPC[i].y = pUndistorted[i].y * scale;
+    pPC[i].z = pUndistorted[i].z * scale - f2rc;
   }
   return;
 }
 
+void VisionaryData::generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, const std::vector<uint32_t>& rgbaMap,
+                                       bool dropInvalid, std::vector<PointXYZRGB> &pointCloud)
+{
+  // Calculate disortion data from XML metadata once.
+  if (m_preCalcCamInfoType != imgType)
+  {
+    preCalcCamInfo(imgType);
+  }
+  const float f2rc = static_cast<float>(m_cameraParams.f2rc / 1000.f); // PointCloud should be in [m] and not in [mm]
+
+  // The RGBA map stores the channels in byte order R, G, B, A
+  generateAttributedPointCloud(map, rgbaMap, m_preCalcCamInfo, m_scaleZ, f2rc, dropInvalid, pointCloud,
+    [](PointXYZRGB& point, uint32_t rgba) { memcpy(&point.r, &rgba, sizeof(rgba)); });
+}
+
+void VisionaryData::generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, const std::vector<uint16_t>& intensityMap,
+                                       bool dropInvalid, std::vector<PointXYZI> &pointCloud)
+{
+  // Calculate disortion data from XML metadata once.
+  if (m_preCalcCamInfoType != imgType)
+  {
+    preCalcCamInfo(imgType);
+  }
+  const float f2rc = static_cast<float>(m_cameraParams.f2rc / 1000.f); // PointCloud should be in [m] and not in [mm]
+
+  generateAttributedPointCloud(map, intensityMap, m_preCalcCamInfo, m_scaleZ, f2rc, dropInvalid, pointCloud,
+    [](PointXYZI& point, uint16_t intensity) { point.intensity = static_cast<float>(intensity); });
+}
+
 void VisionaryData::transformPointCloud(std::vector<PointXYZ> &pointCloud) const
 {
   // turn cam 2 world translations from [m] to [mm]
@@ -210,4 +325,9 @@ const CameraParameters& VisionaryData::getCameraParameters() const
   return m_cameraParams;
 }
 
+uint32_t VisionaryData::getChangeCounter() const
+{
+  return static_cast<uint32_t>(m_changeCounter);
+}
+
 }
@@ -39,6 +39,20 @@ struct DataSetsActive {
   bool hasDataSetCartesian;
 };
 
+// Quality thresholds which are applied while the point cloud is generated.
+// Pixels failing one of the checks are stored as invalid (NaN) points.
+// The default constructed thresholds let every valid pixel pass.
+struct PointCloudThresholds {
+  PointCloudThresholds();
+
+  /// Minimum confidence value (inclusive)
+  uint16_t minConfidence;
+  /// Minimum and maximum intensity value (inclusive)
+  uint16_t minIntensity, maxIntensity;
+  /// Minimum and maximum range in mm (inclusive), radial distance for ToF and Z for stereo devices
+  float minRange, maxRange;
+};
+
 struct PointXYZC {
   float x;
   float y;
@@ -74,6 +88,9 @@ public:
   uint64_t getTimestampMS() const;
   // Returns a reference to the camera parameter struct
   const CameraParameters& getCameraParameters() const;
+  // Returns the change counter of the last parsed XML Metadata part. It changes when the device configuration
+  // (e.g. the resolution) changes.
+  uint32_t getChangeCounter() const;
 
   //-----------------------------------------------
   // functions for parsing received blob
@@ -103,6 +120,35 @@ protected:
   // OUT pointCloud  - Reference to pass back the point cloud. Will be resized and only contain new point cloud.
   void generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, std::vector<PointXYZ> &pointCloud);
 
+  // Calculate the Point Cloud and mask out pixels failing the given thresholds in the same pass.
+  // IN  map           - Image to be transformed
+  // IN  imgType       - Type of the image (needed for correct transformation)
+  // IN  intensityMap  - Intensities checked against the intensity thresholds, empty if not available
+  // IN  confidenceMap - Confidences checked against the confidence threshold, empty if not available
+  // IN  thresholds    - Thresholds to apply
+  // OUT pointCloud    - Reference to pass back the point cloud. Will be resized and only contain new point cloud.
+  void generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType,
+                          const std::vector<uint16_t>& intensityMap, const std::vector<uint16_t>& confidenceMap,
+                          const PointCloudThresholds& thresholds, std::vector<PointXYZ> &pointCloud);
+
+  // Calculate the colored Point Cloud in a single pass over the distance and RGBA map.
+  // IN  map          - Image to be transformed
+  // IN  imgType      - Type of the image (needed for correct transformation)
+  // IN  rgbaMap      - RGBA color of each pixel, must be same length as map
+  // IN  dropInvalid  - If true invalid points are left out, otherwise they are stored as NaN to keep the image layout
+  // OUT pointCloud   - Reference to pass back the point cloud. Will be resized and only contain new point cloud.
+  void generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, const std::vector<uint32_t>& rgbaMap,
+                          bool dropInvalid, std::vector<PointXYZRGB> &pointCloud);
+
+  // Calculate the Point Cloud with intensities in a single pass over the distance and intensity map.
+  // IN  map          - Image to be transformed
+  // IN  imgType      - Type of the image (needed for correct transformation)
+  // IN  intensityMap - Intensity of each pixel, must be same length as map
+  // IN  dropInvalid  - If true invalid points are left out, otherwise they are stored as NaN to keep the image layout
+  // OUT pointCloud   - Reference to pass back the point cloud. Will be resized and only contain new point cloud.
+  void generatePointCloud(const std::vector<uint16_t>& map, const ImageType& imgType, const std::vector<uint16_t>& intensityMap,
+                          bool dropInvalid, std::vector<PointXYZI> &pointCloud);
+
   //-----------------------------------------------
   // Camera parameters to be read from XML Metadata part
   CameraParameters m_cameraParams;
@@ -79,6 +79,7 @@ bool VisionaryDataStream::getNextFrame()
   {
     return false;
   }
+  m_lastFrameTiming.receiveStart = std::chrono::steady_clock::now();
 
   std::vector<uint8_t> buffer;
 
@@ -94,6 +95,7 @@ bool VisionaryDataStream::getNextFrame()
   // Receive the frame data
   int remainingBytesToReceive = packageLength;
   m_pTransport->read(buffer, remainingBytesToReceive);
+  m_lastFrameTiming.receiveEnd = std::chrono::steady_clock::now();
 
   // Check that protocol version and packet type are correct
   const uint16_t protocolVersion = readUnalignBigEndian<uint16_t>(buffer.data());
@@ -109,7 +111,14 @@ bool VisionaryDataStream::getNextFrame()
     return false;
   }
 
-  return parseSegmentBinaryData(buffer.begin() + 3); // Skip protocolVersion and packetType
+  const bool result = parseSegmentBinaryData(buffer.begin() + 3); // Skip protocolVersion and packetType
+  m_lastFrameTiming.parseEnd = std::chrono::steady_clock::now();
+  return result;
+}
+
+const FrameTiming& VisionaryDataStream::getLastFrameTiming() const
+{
+  return m_lastFrameTiming;
 }
 
 bool VisionaryDataStream::parseSegmentBinaryData(std::vector<uint8_t>::iterator itBuf)
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include "VisionaryData.h"
 #include "TcpSocket.h"
@@ -15,6 +16,18 @@
 namespace visionary 
 {
 
+// Host times at which a frame passed the receive steps, taken with std::chrono::steady_clock.
+// The times are taken when the application reads the bytes, bytes queued in the socket before appear as received later.
+struct FrameTiming
+{
+  // The start of the frame was read
+  std::chrono::steady_clock::time_point receiveStart;
+  // All bytes of the frame were read
+  std::chrono::steady_clock::time_point receiveEnd;
+  // The frame was parsed into the data handler
+  std::chrono::steady_clock::time_point parseEnd;
+};
+
 class VisionaryDataStream
 {
 public:
@@ -45,9 +58,14 @@ public:
   // Receive a single blob from the connected device and store it in buffer.
   // Returns true when valid frame completely received.
   bool getNextFrame();
+
+  //-----------------------------------------------
+  // Receive timing of the last frame getNextFrame received.
+  const FrameTiming& getLastFrameTiming() const;
 private:
   std::shared_ptr<VisionaryData>   m_dataHandler;
   std::unique_ptr<TcpSocket>       m_pTransport;
+  FrameTiming                      m_lastFrameTiming;
 
   // Parse the Segment-Binary-Data (Blob data without protocol version and packet type).
   // Returns true when parsing was successful.
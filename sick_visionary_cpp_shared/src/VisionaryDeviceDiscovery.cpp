@@ -0,0 +1,255 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "VisionaryDeviceDiscovery.h"
+
+namespace visionary
+{
+
+VisionaryDeviceDiscovery::VisionaryDeviceDiscovery(Clock::duration scanInterval, Clock::duration timeToLive,
+                                                   int scanTimeout_ms, uint16_t port)
+  : m_scanInterval(scanInterval)
+  , m_timeToLive(timeToLive)
+  , m_scanTimeout_ms(scanTimeout_ms)
+  , m_port(port)
+  , m_running(false)
+  , m_stop(false)
+  , m_scanRequested(false)
+  , m_scanCount(0)
+{
+}
+
+VisionaryDeviceDiscovery::~VisionaryDeviceDiscovery()
+{
+  stop();
+}
+
+void VisionaryDeviceDiscovery::setEventCallback(const EventCallback& callback)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_callback = callback;
+}
+
+void VisionaryDeviceDiscovery::start()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_running)
+  {
+    return;
+  }
+  m_running = true;
+  m_stop = false;
+  m_scanRequested = false;
+  m_thread = std::thread(&VisionaryDeviceDiscovery::run, this);
+}
+
+void VisionaryDeviceDiscovery::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_running)
+    {
+      return;
+    }
+    m_stop = true;
+  }
+  m_wakeUp.notify_one();
+  m_thread.join();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_running = false;
+}
+
+bool VisionaryDeviceDiscovery::isRunning() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_running;
+}
+
+void VisionaryDeviceDiscovery::requestScan()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_scanRequested = true;
+  }
+  m_wakeUp.notify_one();
+}
+
+bool VisionaryDeviceDiscovery::scanOnce()
+{
+  std::lock_guard<std::mutex> scanLock(m_scanMutex);
+  const bool scanned = m_scanner.scan(m_scanTimeout_ms, [this](const DeviceInfo& deviceInfo)
+  {
+    update(deviceInfo, Clock::now());
+  }, m_port);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_scanCount++;
+  }
+  // the devices which answered were just seen, the others age also if the scan failed
+  expire(Clock::now() - m_timeToLive);
+  return scanned;
+}
+
+bool VisionaryDeviceDiscovery::findByMacAddress(const std::string& macAddress, DeviceInfo& deviceInfo) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::unordered_map<std::string, Entry>::const_iterator it = m_devices.find(macAddress);
+  if (it == m_devices.end())
+  {
+    return false;
+  }
+  deviceInfo = it->second.deviceInfo;
+  return true;
+}
+
+bool VisionaryDeviceDiscovery::findBySerialNumber(const std::string& serialNumber, DeviceInfo& deviceInfo) const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::unordered_map<std::string, std::string>::const_iterator serialIt = m_serialNumbers.find(serialNumber);
+  if (serialIt == m_serialNumbers.end())
+  {
+    return false;
+  }
+  std::unordered_map<std::string, Entry>::const_iterator it = m_devices.find(serialIt->second);
+  if (it == m_devices.end())
+  {
+    return false;
+  }
+  deviceInfo = it->second.deviceInfo;
+  return true;
+}
+
+std::vector<VisionaryDeviceDiscovery::DeviceInfo> VisionaryDeviceDiscovery::getDevices() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<DeviceInfo> devices;
+  devices.reserve(m_devices.size());
+  for (std::unordered_map<std::string, Entry>::const_iterator it = m_devices.begin(); it != m_devices.end(); ++it)
+  {
+    devices.push_back(it->second.deviceInfo);
+  }
+  return devices;
+}
+
+void VisionaryDeviceDiscovery::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_devices.clear();
+  m_serialNumbers.clear();
+}
+
+uint64_t VisionaryDeviceDiscovery::getScanCount() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_scanCount;
+}
+
+void VisionaryDeviceDiscovery::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stop)
+  {
+    m_scanRequested = false;
+    const Clock::time_point nextScan = Clock::now() + m_scanInterval;
+    lock.unlock();
+    scanOnce();
+    lock.lock();
+    // an interval shorter than the scan timeout scans back to back
+    m_wakeUp.wait_until(lock, nextScan, [this]() { return m_stop || m_scanRequested; });
+  }
+}
+
+void VisionaryDeviceDiscovery::update(const DeviceInfo& deviceInfo, Clock::time_point now)
+{
+  DeviceInfo previous;
+  bool appeared = false;
+  bool changed = false;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unordered_map<std::string, Entry>::iterator it = m_devices.find(deviceInfo.MacAddress);
+    if (it == m_devices.end())
+    {
+      it = m_devices.insert(std::make_pair(deviceInfo.MacAddress, Entry())).first;
+      appeared = true;
+    }
+    else
+    {
+      previous = it->second.deviceInfo;
+      changed = previous.IpAddress != deviceInfo.IpAddress || previous.SubNet != deviceInfo.SubNet
+        || previous.Port != deviceInfo.Port;
+      std::unordered_map<std::string, std::string>::iterator serialIt = m_serialNumbers.find(previous.SerialNumber);
+      if (previous.SerialNumber != deviceInfo.SerialNumber && serialIt != m_serialNumbers.end()
+        && serialIt->second == deviceInfo.MacAddress)
+      {
+        m_serialNumbers.erase(serialIt);
+      }
+    }
+    it->second.deviceInfo = deviceInfo;
+    it->second.lastSeen = now;
+    if (!deviceInfo.SerialNumber.empty())
+    {
+      m_serialNumbers[deviceInfo.SerialNumber] = deviceInfo.MacAddress;
+    }
+  }
+
+  if (appeared)
+  {
+    notify(DEVICE_APPEARED, deviceInfo, DeviceInfo());
+  }
+  else if (changed)
+  {
+    notify(DEVICE_ADDRESS_CHANGED, deviceInfo, previous);
+  }
+}
+
+void VisionaryDeviceDiscovery::expire(Clock::time_point expiry)
+{
+  std::vector<DeviceInfo> disappeared;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unordered_map<std::string, Entry>::iterator it = m_devices.begin();
+    while (it != m_devices.end())
+    {
+      if (it->second.lastSeen >= expiry)
+      {
+        ++it;
+        continue;
+      }
+      const std::string& serialNumber = it->second.deviceInfo.SerialNumber;
+      std::unordered_map<std::string, std::string>::iterator serialIt = m_serialNumbers.find(serialNumber);
+      // a replacement with the same serial number keeps its entry
+      if (serialIt != m_serialNumbers.end() && serialIt->second == it->first)
+      {
+        m_serialNumbers.erase(serialIt);
+      }
+      disappeared.push_back(it->second.deviceInfo);
+      it = m_devices.erase(it);
+    }
+  }
+
+  for (size_t i = 0; i < disappeared.size(); i++)
+  {
+    notify(DEVICE_DISAPPEARED, disappeared[i], DeviceInfo());
+  }
+}
+
+void VisionaryDeviceDiscovery::notify(Event event, const DeviceInfo& device, const DeviceInfo& previous)
+{
+  EventCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    callback = m_callback;
+  }
+  if (callback)
+  {
+    callback(event, device, previous);
+  }
+}
+
+}
@@ -0,0 +1,142 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "VisionaryAutoIPScan.h"
+
+namespace visionary
+{
+
+/// <summary>
+/// Keeps a table of the devices in the network up to date by repeating an autoIP scan on a background thread.
+/// A device stays in the table until it did not answer for the time to live. Changes are reported as events,
+/// and the table can be looked up by MAC address or serial number at any time without waiting for a scan,
+/// e.g. to find the new IP address of a device when its connection was lost.
+///
+/// All methods may be called from several threads at once.
+/// </summary>
+class VisionaryDeviceDiscovery
+{
+public:
+  typedef std::chrono::steady_clock Clock;
+  typedef VisionaryAutoIPScan::DeviceInfo DeviceInfo;
+
+  enum Event
+  {
+    /// A device answered which was not in the table
+    DEVICE_APPEARED,
+    /// A device did not answer for the time to live and was removed from the table
+    DEVICE_DISAPPEARED,
+    /// A device answered with another IP address, subnet mask or port
+    DEVICE_ADDRESS_CHANGED
+  };
+
+  /// Called on the scanning thread, previous is the old entry of DEVICE_ADDRESS_CHANGED.
+  /// The callback may look up the table, but must not call scanOnce or stop.
+  typedef std::function<void(Event event, const DeviceInfo& device, const DeviceInfo& previous)> EventCallback;
+
+  /// <summary>Create the discovery, the scans are started by <see cref="start" />.</summary>
+  /// <param name="scanInterval">Time from the start of one scan to the start of the next</param>
+  /// <param name="timeToLive">Time a device stays in the table without answering, should cover a few scans</param>
+  /// <param name="scanTimeout_ms">Time each scan waits for answers in milliseconds</param>
+  /// <param name="port">AutoIP port of the devices</param>
+  VisionaryDeviceDiscovery(Clock::duration scanInterval = std::chrono::seconds(5),
+                           Clock::duration timeToLive = std::chrono::seconds(16),
+                           int scanTimeout_ms = 1000, uint16_t port = DEFAULT_PORT);
+
+  /// <summary>Stops the scans.</summary>
+  ~VisionaryDeviceDiscovery();
+
+  /// <summary>Set the callback for device events, set it before <see cref="start" /> to get all events.</summary>
+  void setEventCallback(const EventCallback& callback);
+
+  /// <summary>Start scanning on a background thread, the first scan starts at once.</summary>
+  void start();
+
+  /// <summary>Stop scanning. Waits for a running scan to finish, the table is kept.</summary>
+  void stop();
+
+  bool isRunning() const;
+
+  /// <summary>Start the next scan now instead of after the scan interval.</summary>
+  void requestScan();
+
+  /// <summary>Run one scan on the calling thread and update the table, also when the background thread is not
+  /// running. Blocks for the scan timeout.</summary>
+  /// <returns>False if the scan socket cannot be opened.</returns>
+  bool scanOnce();
+
+  /// <summary>Look up a device by its MAC address as reported by the device.</summary>
+  /// <returns>False if the device is not in the table.</returns>
+  bool findByMacAddress(const std::string& macAddress, DeviceInfo& deviceInfo) const;
+
+  /// <summary>Look up a device by its serial number.</summary>
+  /// <returns>False if no device with this serial number is in the table.</returns>
+  bool findBySerialNumber(const std::string& serialNumber, DeviceInfo& deviceInfo) const;
+
+  /// <summary>Copy of all devices in the table.</summary>
+  std::vector<DeviceInfo> getDevices() const;
+
+  /// <summary>Remove all devices from the table without events.</summary>
+  void clear();
+
+  /// <summary>Number of scans run so far.</summary>
+  uint64_t getScanCount() const;
+
+private:
+  // No copies, the scanning thread refers to the object
+  VisionaryDeviceDiscovery(const VisionaryDeviceDiscovery&);
+  const VisionaryDeviceDiscovery& operator=(const VisionaryDeviceDiscovery&);
+
+  struct Entry
+  {
+    DeviceInfo deviceInfo;
+    Clock::time_point lastSeen;
+  };
+
+  void run();
+  // enter an answer into the table and report the event, if any
+  void update(const DeviceInfo& deviceInfo, Clock::time_point now);
+  // remove and report the devices not seen since expiry
+  void expire(Clock::time_point expiry);
+  void notify(Event event, const DeviceInfo& device, const DeviceInfo& previous);
+
+  const Clock::duration m_scanInterval;
+  const Clock::duration m_timeToLive;
+  const int m_scanTimeout_ms;
+  const uint16_t m_port;
+
+  // The scans of the thread and of scanOnce update the table one after the other
+  std::mutex m_scanMutex;
+  VisionaryAutoIPScan m_scanner;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_wakeUp;
+  std::unordered_map<std::string, Entry> m_devices;
+  // Serial number to MAC address of the devices which reported one
+  std::unordered_map<std::string, std::string> m_serialNumbers;
+  EventCallback m_callback;
+  bool m_running;
+  bool m_stop;
+  bool m_scanRequested;
+  uint64_t m_scanCount;
+  std::thread m_thread;
+};
+
+}
@@ -0,0 +1,248 @@
+//
+// Copyright note: Redistribution and use in source, with or without modification, are permitted.
+//
+// Created: October 2026
+//
+// SICK AG, Waldkirch
+// email: TechSupport0905@sick.de
+
+#include "VisionaryEndian.h"
+
+// The x86 kernels are compiled for their instruction set and selected when the CPU supports it,
+// the library itself does not need to be built for SSSE3 or AVX2
+#if (defined __GNUC__ || defined __clang__) && (defined __x86_64__ || defined __i386__)
+#define VISIONARY_ENDIAN_X86
+#define VISIONARY_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#elif defined _MSC_VER && (defined _M_X64 || defined _M_IX86)
+#define VISIONARY_ENDIAN_X86
+#define VISIONARY_TARGET(isa)
+#include <intrin.h>
+#include <immintrin.h>
+#elif defined __ARM_NEON
+#define VISIONARY_ENDIAN_NEON
+#include <arm_neon.h>
+#endif
+
+namespace visionary
+{
+
+namespace
+{
+
+template <typename T>
+size_t byteswapScalar(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    writeUnaligned<T>(pDst + i * sizeof(T), byteswap(readUnaligned<T>(pSrc + i * sizeof(T))));
+  }
+  return count;
+}
+
+#if defined VISIONARY_ENDIAN_X86
+
+// Byte order within 16 bytes for each element size, repeated for both lanes of AVX2
+const uint8_t kShuffle16[32] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+const uint8_t kShuffle32[32] = {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+const uint8_t kShuffle64[32] = {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8};
+
+// Swap whole blocks of bytes, returns the number of bytes done
+typedef size_t (*ShuffleKernel)(const uint8_t* pSrc, uint8_t* pDst, size_t bytes, const uint8_t* pShuffle);
+
+VISIONARY_TARGET("ssse3")
+size_t shuffleSsse3(const uint8_t* pSrc, uint8_t* pDst, size_t bytes, const uint8_t* pShuffle)
+{
+  const __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pShuffle));
+  size_t i = 0;
+  for (; i + 16u <= bytes; i += 16u)
+  {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + i), _mm_shuffle_epi8(v, shuffle));
+  }
+  return i;
+}
+
+VISIONARY_TARGET("avx2")
+size_t shuffleAvx2(const uint8_t* pSrc, uint8_t* pDst, size_t bytes, const uint8_t* pShuffle)
+{
+  const __m256i shuffle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pShuffle));
+  size_t i = 0;
+  // two registers per iteration keep the loads ahead of the stores
+  for (; i + 64u <= bytes; i += 64u)
+  {
+    const __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+    const __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i + 32u));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), _mm256_shuffle_epi8(v0, shuffle));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i + 32u), _mm256_shuffle_epi8(v1, shuffle));
+  }
+  for (; i + 32u <= bytes; i += 32u)
+  {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pSrc + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + i), _mm256_shuffle_epi8(v, shuffle));
+  }
+  return i;
+}
+
+#if defined _MSC_VER
+bool cpuSupportsSsse3()
+{
+  int info[4];
+  __cpuid(info, 1);
+  return (info[2] & (1 << 9)) != 0;
+}
+
+bool cpuSupportsAvx2()
+{
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7)
+  {
+    return false;
+  }
+  __cpuid(info, 1);
+  // the OS has to save the AVX registers
+  const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6u) == 6u;
+  __cpuidex(info, 7, 0);
+  return osSavesAvx && (info[1] & (1 << 5)) != 0;
+}
+#else
+bool cpuSupportsSsse3()
+{
+  return __builtin_cpu_supports("ssse3") != 0;
+}
+
+bool cpuSupportsAvx2()
+{
+  return __builtin_cpu_supports("avx2") != 0;
+}
+#endif
+
+ShuffleKernel selectKernel()
+{
+  if (cpuSupportsAvx2())
+  {
+    return &shuffleAvx2;
+  }
+  if (cpuSupportsSsse3())
+  {
+    return &shuffleSsse3;
+  }
+  return nullptr;
+}
+
+template <typename T>
+size_t byteswapVector(const uint8_t* pSrc, uint8_t* pDst, size_t count, const uint8_t* pShuffle)
+{
+  // selected once, the initialization of local statics is thread safe
+  static const ShuffleKernel kernel = selectKernel();
+  if (kernel == nullptr)
+  {
+    return 0u;
+  }
+  return kernel(pSrc, pDst, count * sizeof(T), pShuffle) / sizeof(T);
+}
+
+size_t byteswapVector16(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  return byteswapVector<uint16_t>(pSrc, pDst, count, kShuffle16);
+}
+
+size_t byteswapVector32(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  return byteswapVector<uint32_t>(pSrc, pDst, count, kShuffle32);
+}
+
+size_t byteswapVector64(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  return byteswapVector<uint64_t>(pSrc, pDst, count, kShuffle64);
+}
+
+#elif defined VISIONARY_ENDIAN_NEON
+
+size_t byteswapVector16(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8u <= count; i += 8u)
+  {
+    vst1q_u8(pDst + 2u * i, vrev16q_u8(vld1q_u8(pSrc + 2u * i)));
+  }
+  return i;
+}
+
+size_t byteswapVector32(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  size_t i = 0;
+  for (; i + 4u <= count; i += 4u)
+  {
+    vst1q_u8(pDst + 4u * i, vrev32q_u8(vld1q_u8(pSrc + 4u * i)));
+  }
+  return i;
+}
+
+size_t byteswapVector64(const uint8_t* pSrc, uint8_t* pDst, size_t count)
+{
+  size_t i = 0;
+  for (; i + 2u <= count; i += 2u)
+  {
+    vst1q_u8(pDst + 8u * i, vrev64q_u8(vld1q_u8(pSrc + 8u * i)));
+  }
+  return i;
+}
+
+#else
+
+size_t byteswapVector16(const uint8_t*, uint8_t*, size_t)
+{
+  return 0u;
+}
+
+size_t byteswapVector32(const uint8_t*, uint8_t*, size_t)
+{
+  return 0u;
+}
+
+size_t byteswapVector64(const uint8_t*, uint8_t*, size_t)
+{
+  return 0u;
+}
+
+#endif
+
+}
+
+void byteswapArray(const void* src, void* dst, size_t count, size_t elementSize)
+{
+  const uint8_t* pSrc = static_cast<const uint8_t*>(src);
+  uint8_t* pDst = static_cast<uint8_t*>(dst);
+  size_t done;
+
+  // the vector kernels convert whole registers, the scalar code the rest
+  switch (elementSize)
+  {
+  case 2u:
+    done = byteswapVector16(pSrc, pDst, count);
+    byteswapScalar<uint16_t>(pSrc + 2u * done, pDst + 2u * done, count - done);
+    break;
+  case 4u:
+    done = byteswapVector32(pSrc, pDst, count);
+    byteswapScalar<uint32_t>(pSrc + 4u * done, pDst + 4u * done, count - done);
+    break;
+  case 8u:
+    done = byteswapVector64(pSrc, pDst, count);
+    byteswapScalar<uint64_t>(pSrc + 8u * done, pDst + 8u * done, count - done);
+    break;
+  default:
+    // single bytes have no order
+    if (count > 0u && src != dst)
+    {
+      std::memcpy(dst, src, count * elementSize);
+    }
+    break;
+  }
+}
+
+}
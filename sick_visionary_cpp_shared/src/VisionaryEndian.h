@@ -8,10 +8,21 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
+// Byte order of the platform, taken from the compiler unless ENDIAN_LITTLE or ENDIAN_BIG is defined
+#if !defined ENDIAN_LITTLE && !defined ENDIAN_BIG
+#if defined __BYTE_ORDER__ && defined __ORDER_BIG_ENDIAN__ && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define ENDIAN_BIG
+#elif defined __BYTE_ORDER__ && defined __ORDER_LITTLE_ENDIAN__ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 #define ENDIAN_LITTLE
+#elif defined _WIN32
+// all Windows platforms are little endian
+#define ENDIAN_LITTLE
+#endif
+#endif
 
 namespace visionary 
 {
@@ -26,6 +37,12 @@ T readUnaligned(const void *ptr)
   return r;
 }
 
+template<class T>
+void writeUnaligned(void *ptr, T value)
+{
+  memcpy(ptr, &value, sizeof(T));
+}
+
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 
@@ -168,7 +185,7 @@ inline T bigEndianToNative(T x)
   return x;
 }
 #else
-#error Endianess is not defined, please define either LITTLE_ENDIAN or BIG_ENDIAN depending on the platform.
+#error Endianess is not detected, please define either ENDIAN_LITTLE or ENDIAN_BIG depending on the platform.
 #endif
 
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -185,6 +202,103 @@ inline T readUnalignLittleEndian(const void *ptr)
   return littleEndianToNative<T>(readUnaligned<T>(ptr));
 }
 
+template <typename T>
+inline void writeUnalignBigEndian(void *ptr, T value)
+{
+  writeUnaligned<T>(ptr, nativeToBigEndian<T>(value));
+}
+
+template <typename T>
+inline void writeUnalignLittleEndian(void *ptr, T value)
+{
+  writeUnaligned<T>(ptr, nativeToLittleEndian<T>(value));
+}
+
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Arrays, converted with SSSE3, AVX2 or NEON where the CPU supports it
+
+/// Copy count elements of elementSize 1, 2, 4 or 8 bytes from src to dst and reverse the bytes of each element.
+/// src and dst may be equal but must not overlap otherwise, neither has to be aligned.
+void byteswapArray(const void *src, void *dst, size_t count, size_t elementSize);
+
+template <typename T>
+inline void copyArray(const void *src, void *dst, size_t count)
+{
+  if (count > 0u && src != dst)
+  {
+    memcpy(dst, src, count * sizeof(T));
+  }
+}
+
+#if defined ENDIAN_LITTLE
+template <typename T>
+inline void bigEndianArrayToNative(const void *src, void *dst, size_t count)
+{
+  byteswapArray(src, dst, count, sizeof(T));
+}
+
+template <typename T>
+inline void littleEndianArrayToNative(const void *src, void *dst, size_t count)
+{
+  copyArray<T>(src, dst, count);
+}
+#else
+template <typename T>
+inline void bigEndianArrayToNative(const void *src, void *dst, size_t count)
+{
+  copyArray<T>(src, dst, count);
+}
+
+template <typename T>
+inline void littleEndianArrayToNative(const void *src, void *dst, size_t count)
+{
+  byteswapArray(src, dst, count, sizeof(T));
+}
+#endif
+
+/// Read count big endian values from unaligned memory
+template <typename T>
+inline void readBigEndianArray(const void *src, T *dst, size_t count)
+{
+  bigEndianArrayToNative<T>(src, dst, count);
+}
+
+/// Read count little endian values from unaligned memory
+template <typename T>
+inline void readLittleEndianArray(const void *src, T *dst, size_t count)
+{
+  littleEndianArrayToNative<T>(src, dst, count);
+}
+
+/// Write count values big endian to unaligned memory
+template <typename T>
+inline void writeBigEndianArray(void *dst, const T *src, size_t count)
+{
+  // the conversion is symmetric
+  bigEndianArrayToNative<T>(src, dst, count);
+}
+
+/// Write count values little endian to unaligned memory
+template <typename T>
+inline void writeLittleEndianArray(void *dst, const T *src, size_t count)
+{
+  littleEndianArrayToNative<T>(src, dst, count);
+}
+
+/// Convert count values between big endian and native byte order in place
+template <typename T>
+inline void swapBigEndianArray(T *data, size_t count)
+{
+  bigEndianArrayToNative<T>(data, data, count);
+}
+
+/// Convert count values between little endian and native byte order in place
+template <typename T>
+inline void swapLittleEndianArray(T *data, size_t count)
+{
+  littleEndianArrayToNative<T>(data, data, count);
+}
+
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
 }
@@ -164,11 +164,26 @@ void VisionarySData::generatePointCloud(std::vector<PointXYZ> &pointCloud)
   return VisionaryData::generatePointCloud(m_zMap, VisionaryData::PLANAR, pointCloud);
 }
 
+void VisionarySData::generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds)
+{
+  return VisionaryData::generatePointCloud(m_zMap, VisionaryData::PLANAR, std::vector<uint16_t>(), m_confidenceMap, thresholds, pointCloud);
+}
+
+void VisionarySData::generatePointCloud(std::vector<PointXYZRGB> &pointCloud, bool dropInvalid)
+{
+  return VisionaryData::generatePointCloud(m_zMap, VisionaryData::PLANAR, m_rgbaMap, dropInvalid, pointCloud);
+}
+
 const std::vector<uint16_t>& VisionarySData::getZMap() const
 {
   return m_zMap;
 }
 
+std::vector<uint16_t>& VisionarySData::getZMap()
+{
+  return m_zMap;
+}
+
 const std::vector<uint32_t>& VisionarySData::getRGBAMap() const
 {
   return m_rgbaMap;
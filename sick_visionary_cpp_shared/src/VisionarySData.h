@@ -25,10 +25,19 @@ public:
   //-----------------------------------------------
   // Getter Functions
   const std::vector<uint16_t>& getZMap() const;
+  // Writable access to the map, e.g. to filter it in place before the point cloud is generated
+  std::vector<uint16_t>& getZMap();
   const std::vector<uint32_t>& getRGBAMap() const;
   const std::vector<uint16_t>& getConfidenceMap() const;
   // Calculate and return the Point Cloud in the camera perspective. Units are in meters.
   void generatePointCloud(std::vector<PointXYZ> &pointCloud);
+  // Calculate the Point Cloud like above, pixels failing the confidence or range thresholds
+  // are set to invalid (NaN) in the same pass. The RGBA map is no intensity, so the
+  // intensity thresholds are ignored.
+  void generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds);
+  // Calculate and return the colored Point Cloud in the camera perspective. Units are in meters.
+  // If dropInvalid is set, invalid points are left out, otherwise they are NaN and the cloud keeps the image layout.
+  void generatePointCloud(std::vector<PointXYZRGB> &pointCloud, bool dropInvalid = false);
 
 protected:
   //-----------------------------------------------
@@ -328,11 +328,26 @@ void VisionaryTData::generatePointCloud(std::vector<PointXYZ> &pointCloud)
   return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, pointCloud);
 }
 
+void VisionaryTData::generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds)
+{
+  return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, m_intensityMap, m_confidenceMap, thresholds, pointCloud);
+}
+
+void VisionaryTData::generatePointCloud(std::vector<PointXYZI> &pointCloud, bool dropInvalid)
+{
+  return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, m_intensityMap, dropInvalid, pointCloud);
+}
+
 const std::vector<uint16_t>& VisionaryTData::getDistanceMap() const
 {
   return m_distanceMap;
 }
 
+std::vector<uint16_t>& VisionaryTData::getDistanceMap()
+{
+  return m_distanceMap;
+}
+
 const std::vector<uint16_t>& VisionaryTData::getIntensityMap() const
 {
   return m_intensityMap;
@@ -32,6 +32,8 @@ public:
   //-----------------------------------------------
   // Getter Functions
   const std::vector<uint16_t>& getDistanceMap() const;
+  // Writable access to the map, e.g. to filter it in place before the point cloud is generated
+  std::vector<uint16_t>& getDistanceMap();
   const std::vector<uint16_t>& getIntensityMap() const;
   const std::vector<uint16_t>& getConfidenceMap() const;
   // Returns Number of points get by the polar reduction.
@@ -49,6 +51,14 @@ public:
   // Calculate and return the Point Cloud in the camera perspective. Units are in meters.
   void generatePointCloud(std::vector<PointXYZ> &pointCloud);
 
+  // Calculate the Point Cloud like above, pixels failing the confidence, intensity or range
+  // thresholds are set to invalid (NaN) in the same pass.
+  void generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds);
+
+  // Calculate and return the Point Cloud with intensities in the camera perspective. Units are in meters.
+  // If dropInvalid is set, invalid points are left out, otherwise they are NaN and the cloud keeps the image layout.
+  void generatePointCloud(std::vector<PointXYZI> &pointCloud, bool dropInvalid = false);
+
 protected:
   //-----------------------------------------------
   // functions for parsing received blob
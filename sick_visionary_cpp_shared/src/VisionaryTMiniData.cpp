@@ -189,11 +189,26 @@ void VisionaryTMiniData::generatePointCloud(std::vector<PointXYZ> &pointCloud)
   return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, pointCloud);
 }
 
+void VisionaryTMiniData::generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds)
+{
+  return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, m_intensityMap, std::vector<uint16_t>(), thresholds, pointCloud);
+}
+
+void VisionaryTMiniData::generatePointCloud(std::vector<PointXYZI> &pointCloud, bool dropInvalid)
+{
+  return VisionaryData::generatePointCloud(m_distanceMap, VisionaryData::RADIAL, m_intensityMap, dropInvalid, pointCloud);
+}
+
 const std::vector<uint16_t>& VisionaryTMiniData::getDistanceMap() const
 {
   return m_distanceMap;
 }
 
+std::vector<uint16_t>& VisionaryTMiniData::getDistanceMap()
+{
+  return m_distanceMap;
+}
+
 const std::vector<uint16_t>& VisionaryTMiniData::getIntensityMap() const
 {
   return m_intensityMap;
@@ -28,6 +28,8 @@ public:
     // Gets the radial distance map
   // The unit of the distancemap is 1/4 mm
   const std::vector<uint16_t>& getDistanceMap() const;
+  // Writable access to the map, e.g. to filter it in place before the point cloud is generated
+  std::vector<uint16_t>& getDistanceMap();
 
   // Gets the intensity map
   const std::vector<uint16_t>& getIntensityMap() const;
@@ -35,6 +37,15 @@ public:
   // Calculate and return the Point Cloud in the camera perspective. Units are in meters.
   void generatePointCloud(std::vector<PointXYZ> &pointCloud);
 
+  // Calculate the Point Cloud like above, pixels failing the intensity or range thresholds
+  // are set to invalid (NaN) in the same pass. The device sends no confidence map,
+  // so the confidence threshold is ignored.
+  void generatePointCloud(std::vector<PointXYZ> &pointCloud, const PointCloudThresholds& thresholds);
+
+  // Calculate and return the Point Cloud with intensities in the camera perspective. Units are in meters.
+  // If dropInvalid is set, invalid points are left out, otherwise they are NaN and the cloud keeps the image layout.
+  void generatePointCloud(std::vector<PointXYZI> &pointCloud, bool dropInvalid = false);
+
   // factor to convert Radial distance map from fixed point to floating point
   static const float DISTANCE_MAP_UNIT;
 